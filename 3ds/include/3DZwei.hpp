@@ -28,6 +28,8 @@
 #define _3DZWEI_3DZWEI_HPP
 
 #include "Config.hpp"
+#include "Lang.hpp"
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include <memory>
 #include <string>
@@ -39,7 +41,7 @@ public:
 
 	static std::unique_ptr<Config> CFG; // Need to do this static for the other overlays to access.
 private:
-	bool Exiting = false, FullExit = false, FadeIn = true, FadeOut = false;
+	bool Exiting = false, FullExit = false;
 	uint8_t FAlpha = 0;
 
 	void PrepareGame();
@@ -50,6 +52,7 @@ private:
 	void OverlayReturn();
 	void FadeOutHandler();
 	void FadeInHandler();
+	void DrawScene();
 	void Draw();
 
 	const std::vector<FuncCallback> Positions = {
@@ -58,8 +61,9 @@ private:
 		{ 90, 125, 140, 35, [this]() { this->AccessSettings(); } }, // Settings.
 		{ 90, 170, 140, 35, [this]() { this->ShowCredits(); } } // Credits.
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
 
-	const std::vector<std::string> ButtonNames = { "MAIN_MENU_GAME", "MAIN_MENU_RULES", "MAIN_MENU_SETTINGS", "MAIN_MENU_CREDITS" };
+	const std::vector<Lang::Str> ButtonNames = { Lang::Str::MAIN_MENU_GAME, Lang::Str::MAIN_MENU_RULES, Lang::Str::MAIN_MENU_SETTINGS, Lang::Str::MAIN_MENU_CREDITS };
 };
 
 #endif
\ No newline at end of file
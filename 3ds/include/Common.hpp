@@ -28,7 +28,9 @@
 #define _3DZWEI_COMMON_HPP
 
 #include "3DZwei.hpp" // Main Overlay.
+#include "Clock.hpp" // Animation timing.
 #include "GFX.hpp" // Graphics.
+#include "Input.hpp" // Key and Touch input.
 #include "Lang.hpp" // Multi-Language stuff.
 #include "Pointer.hpp" // Pointer Callbacks.
 #include "screenCommon.hpp" // Universal-Core.
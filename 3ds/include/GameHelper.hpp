@@ -27,95 +27,181 @@
 #ifndef _3DZWEI_GAME_HELPER_HPP
 #define _3DZWEI_GAME_HELPER_HPP
 
+#include "Animator.hpp" // Tweens.
+#include "BoardLayout.hpp" // Card Positions.
+#include "CachedLayer.hpp" // Top Screen.
+#include "Particles.hpp" // Pair effects.
+#include "Scene.hpp" // Gamefield.
 #include "GameSettings.hpp" // Game Params.
+#include "GFX.hpp" // Intro cards.
+#include "Gesture.hpp" // Page drags.
 #include "StackMem.hpp" // Game class.
+#include "Timer.hpp" // Card delay.
+#include "HitIndex.hpp" // Page Buttons.
 #include "Pointer.hpp"
 #include <vector> // Positions.
 
 class GameHelper {
 public:
 	enum class LogicState : uint8_t { Nothing = 0, P1Won = 1, P2Won = 2, Tie = 3 };
+	enum class Phase : uint8_t { Intro = 0, Play = 1, Outro = 2 };
+
+	/*
+		Everything the screens show of a game, copied from the StackMem and the animations.
+		The draw functions only read a snapshot, so the logic can already go on while it's drawn.
+
+		uint32_t FieldVersion: Changes, if the cards or the page changed, so the Gamefield has to be built again.
+		uint32_t MarkID: Changes with each visible change of a press. The drawing reports MarkTag and MarkFrame to
+			Input::Presented(), once a snapshot with a new MarkID is on the screen.
+	*/
+	struct Snapshot {
+		struct Card { int Type = 0; bool Shown = false; bool Collected = false; };
+
+		std::vector<Card> Cards = { };
+		int TurnCards[2] = { -1, -1 };
+		bool CardClicked[2] = { false };
+		float ClickedScale[2] = { 1.0f, 1.0f };
+		size_t PlayerPairs[2] = { 0 }, Guesses[2] = { 0 };
+		StackMem::Players CurrentPlayer = StackMem::Players::Player1;
+		StackMem::TurnState State = StackMem::TurnState::DrawFirst;
+
+		Phase CurPhase = Phase::Play;
+		uint8_t IntroType = 0;
+		float Fade = 0.0f;
+		std::vector<float> WaveOffset = { }, GrowScale = { };
+
+		size_t Page = 0, SwipeTarget = 0;
+		bool Swiping = false;
+		float SwipePos = 0.0f;
+		uint32_t Round = 0, FieldVersion = 0;
+		Particles Effects;
+
+		float PointerX = 0.0f, PointerY = 0.0f;
+		bool ShowPointer = false;
+
+		const char *MarkTag = nullptr;
+		uint32_t MarkFrame = 0, MarkID = 0;
+	};
 
 	GameHelper(const GameSettings::GameParams Params = { }); // Constructor.
 	void StartGame(const bool AlreadyInitialized = true, const GameSettings::GameParams Params = { }, const bool P2Won = true);
 
-	void DrawTryPlay(void) const;
-	void DrawNormalPlay(void) const;
-	void DrawTop(void) const;
-	void DrawField(const bool ShowPointer = true) const;
+	void Publish(Snapshot &S) const;
+	void DrawTryPlay(const Snapshot &S) const;
+	void DrawNormalPlay(const Snapshot &S) const;
+	void DrawTop(const Snapshot &S) const;
+	void DrawField(const Snapshot &S) const;
 
-	LogicState Logic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition T);
+	LogicState Logic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition T, const uint32_t PressFrame);
+	bool WantsInput() const;
+	void Tick();
 	GameSettings::GameParams &ReturnParams() { return this->Params; }
 private:
+	enum class AnimGroup : uint8_t { Intro = 1, Outro = 2, Page = 3, Cards = 4 };
+
 	std::unique_ptr<StackMem> Game = nullptr;
 	GameSettings::GameParams Params = { };
 	size_t Page = 0, Selection = 0;
-	bool RefreshFrame = true; // Used for the delay mode to properly display the card.
+	Timer CardTimer; // Used for the delay mode.
+
+	/* Animation related. The game is only playable in the Play phase. */
+	Animator Anims;
+	Phase CurPhase = Phase::Play;
+	LogicState Result = LogicState::Nothing; // Set, once the End-Game Animation is done.
+
+	/* Start and End Animation related. Fade also moves the characters. */
+	uint8_t IntroType = 0; // 0: None, 1: Falling, 2: Growing.
+	float Fade = 0.0f;
+	std::vector<float> WaveOffset = { }, GrowScale = { }; // Per wave of the layout, per card.
+
+	/* Page Swipe related. While Dragging, the pages follow the finger instead of an animation. */
+	bool Swiping = false, Dragging = false;
+	size_t SwipeTarget = 0;
+	float SwipePos = 0.0f;
+
+	/* Touch related. A tap during a card animation waits for the next turn, like a queued press. */
+	Gesture Touch;
+	Timer TapTimer;
+	float TapX = 0.0f, TapY = 0.0f;
+
+	/*
+		Latency related. Cause is the scanned frame of the press handled right now, or 0. Each press marks only
+		its first visible change, so a press without one doesn't count into a later change.
+	*/
+	uint32_t Cause = 0, TouchFrame = 0;
+	const char *MarkTag = nullptr;
+	uint32_t MarkFrame = 0, MarkID = 0;
+	void Mark(const char *Tag);
+
+	/* Round statistics. Round also counts the rounds of the game. */
+	size_t Turns = 0, Misses = 0;
+	uint32_t Round = 0;
+	StackMem::Players Starter = StackMem::Players::Player1;
 
 	/* Turn Card variables. The clicked state AND card scale (0.0f up to 1.0f). */
 	bool CardClicked[2] = { false };
 	float ClickedScale[2] = { 1.0f };
+	Particles Effects; // Fragments of collected pairs.
+
+	/*
+		Draw related. The top screen only changes with a turn, so it's rendered once into a layer.
+		Those are only touched by the draw functions, the logic only changes FieldVersion.
+	*/
+	mutable CachedLayer TopLayer;
+	CachedLayer::Key TopKey(const Snapshot &S) const;
+	bool DoFadeRect(const Snapshot &S) const;
+
+	/* The Gamefield keeps both pages of a swipe as nodes, they're only built again if a card or the page changed. */
+	mutable Scene Field;
+	Scene::NodeID PageNodes[2] = { 0, 0 }; // The current page and the swipe target.
+	uint32_t FieldVersion = 0;
+	mutable uint32_t BuiltVersion = 0;
+	void BuildPage(const Snapshot &S, const Scene::NodeID Node, const size_t Pg) const;
+	mutable GFX::CardBatch IntroBatch;
+	void DrawIntro(const Snapshot &S) const;
 
 	/* Page related. */
 	bool CanGoForward(const size_t CurPage) const;
+	size_t TargetPage() const;
 	bool PrevPage();
 	bool NextPage();
+	void DragPage(const float DX);
+	void DropPage(const bool Switch);
 
 	/* Utility related. */
-	void CheckCard(const uint8_t Idx);
-	std::vector<uint8_t> GetAnimationIdx(const uint8_t Round) const;
-	uint8_t GetIndexCount() const;
+	void SelectCard(const size_t Slot);
+	bool Press(const float X, const float Y);
+	void CheckCard(const size_t Slot);
+	size_t IntroCards(const size_t Cards) const;
 
 	/* Turn based related. */
-	LogicState TurnChecks();
+	bool DelayDone(const uint32_t Down);
+	bool CardsBusy() const;
+	bool Picking() const;
+	void TurnChecks();
 	LogicState AILogic(const uint32_t Down);
-	LogicState PlayerLogic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition T);
+	LogicState PlayerLogic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const Gesture::Type G);
 
 	/* Include all Animations here. */
-	void StartGameAnimationFalling();
-	void StartGameAnimationGrowing();
+	void StartGameAnimationFalling(const std::function<void()> &Done);
+	void StartGameAnimationGrowing(const std::function<void()> &Done);
 	void StartGameAnimation();
+	void SwipePage(const size_t Target, const uint32_t Frames, const std::function<void()> &Done = nullptr);
 	void PageAnimation(const bool Forward);
-	void AIPageAnimation(const int Page);
+	void AIPageAnimation(const size_t Page, const std::function<void()> &Done = nullptr);
 	void PickAnimation(const size_t Idx);
-	void HideAnimation();
-	void ShrinkAnimation();
-	void EndGameAnimation();
+	void HideAnimation(const std::function<void()> &Done);
+	void ShrinkAnimation(const std::function<void()> &Done);
+	void PairBurst();
+	void EndGameAnimation(const std::function<void()> &Done);
 
 	/* Card Positions. */
-	const std::vector<FuncCallback> CPos = {
-		/* Row 1. */
-		{ 20.5, 8.5, 55, 55, [this]() { this->CheckCard(0); } },
-		{ 20.5 + (1 * 56), 8.5, 55, 55, [this]() { this->CheckCard(1); } },
-		{ 20.5 + (2 * 56), 8.5, 55, 55, [this]() { this->CheckCard(2); } },
-		{ 20.5 + (3 * 56), 8.5, 55, 55, [this]() { this->CheckCard(3); } },
-		{ 20.5 + (4 * 56), 8.5, 55, 55, [this]() { this->CheckCard(4); } },
-
-		/* Row 2. */
-		{ 20.5, 8.5 + (1 * 56), 55, 55, [this]() { this->CheckCard(5); } },
-		{ 20.5 + (1 * 56), 8.5 + (1 * 56), 55, 55, [this]() { this->CheckCard(6); } },
-		{ 20.5 + (2 * 56), 8.5 + (1 * 56), 55, 55, [this]() { this->CheckCard(7); } },
-		{ 20.5 + (3 * 56), 8.5 + (1 * 56), 55, 55, [this]() { this->CheckCard(8); } },
-		{ 20.5 + (4 * 56), 8.5 + (1 * 56), 55, 55, [this]() { this->CheckCard(9); } },
-
-		/* Row 3. */
-		{ 20.5, 8.5 + (2 * 56), 55, 55, [this]() { this->CheckCard(10); } },
-		{ 20.5 + (1 * 56), 8.5 + (2 * 56), 55, 55, [this]() { this->CheckCard(11); } },
-		{ 20.5 + (2 * 56), 8.5 + (2 * 56), 55, 55, [this]() { this->CheckCard(12); } },
-		{ 20.5 + (3 * 56), 8.5 + (2 * 56), 55, 55, [this]() { this->CheckCard(13); } },
-		{ 20.5 + (4 * 56), 8.5 + (2 * 56), 55, 55, [this]() { this->CheckCard(14); } },
-
-		/* Row 4. */
-		{ 20.5, 8.5 + (3 * 56), 55, 55, [this]() { this->CheckCard(15); } },
-		{ 20.5 + (1 * 56), 8.5 + (3 * 56), 55, 55, [this]() { this->CheckCard(16); } },
-		{ 20.5 + (2 * 56), 8.5 + (3 * 56), 55, 55, [this]() { this->CheckCard(17); } },
-		{ 20.5 + (3 * 56), 8.5 + (3 * 56), 55, 55, [this]() { this->CheckCard(18); } },
-		{ 20.5 + (4 * 56), 8.5 + (3 * 56), 55, 55, [this]() { this->CheckCard(19); } },
-
-		/* Pages switches. */
+	BoardLayout Layout;
+	const std::vector<FuncCallback> PageButtons = {
 		{ 0, 0, 15, 240, [this]() { this->PrevPage(); } },
 		{ 300, 0, 20, 240, [this]() { this->NextPage(); } }
 	};
+	const HitIndex PageButtonsIndex = HitIndex(this->PageButtons);
 };
 
 #endif
\ No newline at end of file
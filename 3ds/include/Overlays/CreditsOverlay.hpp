@@ -27,6 +27,8 @@
 #ifndef _3DZWEI_CREDITS_OVERLAY_HPP
 #define _3DZWEI_CREDITS_OVERLAY_HPP
 
+#include "Gesture.hpp" // Page drags.
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include <vector>
 
@@ -35,26 +37,34 @@ public:
 	CreditsOverlay() { }
 	void Action();
 private:
-	bool Done = false, FullDone = false, FadeIn = true, DoSwipe = false, SwipeDirection = false, InitialSwipe = true;
+	bool Done = false, FadeIn = true, DoSwipe = false, SwipeDirection = false, InitialSwipe = true,
+		Dragging = false, SwipeBack = false;
 	int16_t Page = 0, FAlpha = 255, PrevPos = -400, CurPos = -400, NextPos = 400;
 	float Cubic = 0.0f;
+	Gesture Touch;
 
 	void PrevPage();
 	void OK();
 	void NextPage();
+	void MovePages();
+	void DragPage(const float DX);
+	void DropPage(const bool Switch);
 	void DrawPage(const int16_t Pg, const int AddOffs);
+	void Draw();
 	void Handler();
 
 	const std::vector<FuncCallback> Positions = {
 		{ 0, 25, 25, 215, [this]() { this->PrevPage(); } },
 		{ 375, 25, 25, 215, [this]() { this->NextPage(); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
 
 	const std::vector<FuncCallback> BottomPos = {
 		{ 70, 75, 25, 90, [this]() { this->PrevPage(); } },
 		{ 123, 109, 74, 22, [this]() { this->OK(); } },
 		{ 225, 75, 25, 90, [this]() { this->NextPage(); } }
 	};
+	const HitIndex BottomPosIndex = HitIndex(this->BottomPos);
 };
 
 #endif
\ No newline at end of file
@@ -28,20 +28,51 @@
 #define _3DZWEI_GAME_OVERLAY_HPP
 
 #include "GameHelper.hpp"
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
+#include "Transition.hpp" // Prompt background.
+#include "TripleBuffer.hpp" // Frame snapshots.
+#include <atomic> // Shared with the logic thread.
 #include <vector>
 
+/*
+	The game screen.
+
+	The logic runs on its own thread and publishes a frame snapshot each time something changed,
+	this thread only draws the latest snapshot. So a slow AI move or file access doesn't stall the drawing.
+*/
 class GameOverlay {
 public:
 	GameOverlay(const GameSettings::GameParams Params = { });
 	void Action();
 private:
+	/* Everything, what the screens show. */
+	struct Frame {
+		GameHelper::Snapshot Game;
+		int16_t FAlpha = 0;
+		bool PromptHandle = false, PromptAnswer = false, SwipeIn = false, SwipeOut = false;
+	};
+
 	std::unique_ptr<GameHelper> Helper = nullptr;
-	bool Running = true, SwipeIn = false, SwipeOut = false, PromptHandle = false, PromptAnswer = false;
+	std::atomic<bool> Running = true, LogicActive = false;
+	GameHelper::LogicState Result = GameHelper::LogicState::Nothing; // The result of the round, once it ended.
+
+	/* Those are only touched by the logic. */
+	bool SwipeIn = false, SwipeOut = false, PromptHandle = false, PromptAnswer = false;
 	int16_t SwipePos = 320, FAlpha = 0;
 	float Cubic = 0.0f;
 
+	/* Those are only touched by the drawing. */
+	TripleBuffer<Frame> Frames;
+	std::unique_ptr<Transition> Snap = nullptr; // The game doesn't change while prompting, so it's only rendered once.
+	uint32_t ShownMark = 0; // The last latency mark, which got presented.
+
 	void Draw();
+	void Play();
+	bool Step();
+	void Publish();
+	Thread StartLogic();
+	static void LogicLoop(void *Arg);
 	void PromptLogic();
 	void Confirm();
 	void Cancel();
@@ -50,6 +81,7 @@ private:
 		{ 24, 140, 124, 48, [this]() { this->Cancel(); } },
 		{ 172, 140, 124, 48, [this]() { this->Confirm(); } }
 	};
+	const HitIndex PromptIndex = HitIndex(this->Prompt);
 };
 
 #endif
\ No newline at end of file
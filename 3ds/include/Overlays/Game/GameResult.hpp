@@ -27,7 +27,10 @@
 #ifndef _3DZWEI_GAME_RESULT_HPP
 #define _3DZWEI_GAME_RESULT_HPP
 
+#include "GFX.hpp" // Card batches.
 #include "GameSettings.hpp"
+#include "PageGrid.hpp" // Background cards.
+#include "Particles.hpp" // Winner confetti.
 #include "Pointer.hpp"
 #include <vector>
 
@@ -45,9 +48,11 @@ private:
 	void DrawSolo(const GameSettings::GameParams &Params);
 
 	bool Done = false, FullDone = false, Over = false, DoSwipe = true, DoScrollSwipe = false, InitialScroll = true, ScrollMode = false;
-	int16_t Delay = 255, ScrollIdx = -240, ScrollDelay = 60;
+	int16_t Delay = 255, ScrollIdx = -240;
 	size_t ScrollPage = 0;
-	float Cubic = 0.0f, ScrollCubic = 0.0f;
+	float Cubic = 0.0f, ScrollCubic = 0.0f, ScrollDelay = 60.0f; // ScrollDelay is in 60 FPS frames.
+	bool HasWinner = false;
+	Particles Confetti; // Shown, once the winner swiped in.
 
 	const std::vector<FuncCallback> InitialScrollPos = {
 		{ 36, 37, 55, 55 },
@@ -65,6 +70,8 @@ private:
 		{ 218, 171, 55, 55 },
 		{ 309, 171, 55, 55 }
 	};
+	PageGrid CardGrid = PageGrid(this->InitialScrollPos, 0, 12);
+	GFX::CardBatch Batch;
 };
 
 #endif
\ No newline at end of file
@@ -27,6 +27,7 @@
 #ifndef _3DZWEI_GAME_SETTINGS_HPP
 #define _3DZWEI_GAME_SETTINGS_HPP
 
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include "StackMem.hpp"
 #include <string>
@@ -61,7 +62,7 @@ private:
 
 	GameParams Params;
 	Tabs Tab = Tabs::General;
-	bool Done = false, FullDone = false, DoSwipe = false, SwipeDirection = false, InitialSwipe = true, IsSetting = false;
+	bool Done = false, DoSwipe = false, SwipeDirection = false, InitialSwipe = true, IsSetting = false;
 	int FAlpha = 255, T1Offs = -320, T2Offs = 320;
 	float Cubic = 0.0f;
 
@@ -114,6 +115,7 @@ private:
 		{ 0, 223, 17, 17, [this]() { this->Cancel(); } },
 		{ 303, 223, 17, 17, [this]() { this->OK(); } }
 	};
+	const HitIndex GeneralPosIndex = HitIndex(this->GeneralPos);
 
 	/* Player Tab. */
 	const std::vector<FuncCallback> PlayerPos = {
@@ -131,6 +133,7 @@ private:
 		{ 0, 223, 17, 17, [this]() { this->Cancel(); } },
 		{ 303, 223, 17, 17, [this]() { this->OK(); } }
 	};
+	const HitIndex PlayerPosIndex = HitIndex(this->PlayerPos);
 };
 
 #endif
\ No newline at end of file
@@ -48,11 +48,11 @@ private:
 	};
 
 	int16_t FAlpha = 255;
-	int16_t X = 140, Y = 120; // Pointer Pos.
-	int16_t Delay = 100; // Wait Delay.
+	float X = 140.0f, Y = 120.0f; // Pointer Pos.
+	float Delay = 100.0f; // Wait Delay in 60 FPS frames.
 	bool CardClicks[2] = { false }; // If cards are clicked or nah.
 	States State = States::GotoFirst; // The Current State.
-	bool Done = false, FullDone = false;
+	bool Done = false;
 
 	/* Card Flip related. */
 	bool CardFlipped[2] = { false }, FlipDone[2] = { false };
@@ -65,6 +65,7 @@ private:
 	void State4();
 	void State5();
 	void StateHandler();
+	void Draw();
 
 	const std::vector<FuncCallback> Cards = {
 		/* Row 1. */
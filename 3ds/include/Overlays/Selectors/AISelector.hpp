@@ -27,6 +27,8 @@
 #ifndef _3DZWEI_AI_SELECTOR_HPP
 #define _3DZWEI_AI_SELECTOR_HPP
 
+#include "Lang.hpp"
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include "StackMem.hpp"
 #include <vector>
@@ -38,7 +40,7 @@ public:
 private:
 	StackMem::AIMethod Res = StackMem::AIMethod::Random;
 	uint8_t Mode = 0;
-	bool Done = false, FullDone = false, Cancelled = false, SwipeDirection = false,
+	bool Done = false, Cancelled = false, SwipeDirection = false,
 		DoSwipe = false, InitialSwipe = true, FadeIn = true;
 	int16_t FAlpha = 255, PrevPos = -400, CurPos = -400, NextPos = 400;
 	float Cubic = 0.0f;
@@ -48,16 +50,18 @@ private:
 	void OK();
 	void Cancel();
 	void DrawPage(const int16_t Pg, const int AddOffs);
+	void Draw();
 	void Handler();
 
-	const std::vector<std::string> Modes    = { "AI_MODE_RANDOM", "AI_MODE_MEDIUM", "AI_MODE_HARD", "AI_MODE_EXTREME" };
-	const std::vector<std::string> ModeDesc = { "AI_MODE_RANDOM_DESC", "AI_MODE_MEDIUM_DESC", "AI_MODE_HARD_DESC", "AI_MODE_EXTREME_DESC" };
+	const std::vector<Lang::Str> Modes    = { Lang::Str::AI_MODE_RANDOM, Lang::Str::AI_MODE_MEDIUM, Lang::Str::AI_MODE_HARD, Lang::Str::AI_MODE_EXTREME };
+	const std::vector<Lang::Str> ModeDesc = { Lang::Str::AI_MODE_RANDOM_DESC, Lang::Str::AI_MODE_MEDIUM_DESC, Lang::Str::AI_MODE_HARD_DESC, Lang::Str::AI_MODE_EXTREME_DESC };
 
 	const std::vector<FuncCallback> Positions = {
 		{ 0, 25, 25, 215, [this]() { this->PrevMode(); } },
 		{ 375, 25, 25, 215, [this]() { this->NextMode(); } },
 		{ 145, 200, 110, 25, [this]() { this->OK(); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
 
 	const std::vector<FuncCallback> BottomPos = {
 		{ 70, 75, 25, 90, [this]() { this->PrevMode(); } },
@@ -65,6 +69,7 @@ private:
 		{ 225, 75, 25, 90, [this]() { this->NextMode(); } },
 		{ 0, 223, 17, 17, [this]() { this->Cancel(); } }
 	};
+	const HitIndex BottomPosIndex = HitIndex(this->BottomPos);
 };
 
 #endif
\ No newline at end of file
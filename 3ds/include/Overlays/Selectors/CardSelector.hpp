@@ -27,6 +27,10 @@
 #ifndef _3DZWEI_CARD_SELECTOR_HPP
 #define _3DZWEI_CARD_SELECTOR_HPP
 
+#include "GFX.hpp" // Card batches.
+#include "Gesture.hpp" // Page drags.
+#include "HitIndex.hpp"
+#include "PageGrid.hpp" // Visible cards.
 #include "Pointer.hpp"
 #include <vector>
 
@@ -36,20 +40,26 @@ public:
 	void Action();
 private:
 	std::vector<bool> Cards = { };
-	bool Done = false, FullDone = false, Changed = false, FadeIn = true, DoSwipe = false, SwipeDir = false, InitialSwipe = true;
+	bool Done = false, Changed = false, FadeIn = true, DoSwipe = false, SwipeDir = false, InitialSwipe = true,
+		Dragging = false, SwipeBack = false;
 	uint8_t FAlpha = 255;
 	int PrevPos = -400, CurPos = -400, NextPos = 400;
 	size_t Page = 0;
 	float Cubic = 0.0f;
+	Gesture Touch;
 
 	void PrevPage();
 	void NextPage();
+	void MovePages();
+	void DragPage(const float DX);
+	void DropPage(const bool Switch);
 	bool CanGoNext() const;
 	void OK();
 	void ToggleCard(const uint8_t Idx);
 	void SelectAll();
 	void SelectNone();
 
+	void DrawPage(const size_t Pg, const int AddOffs);
 	void DrawTop();
 	void DrawBottom();
 	void PageFadeHandler();
@@ -84,6 +94,9 @@ private:
 		{ 220, 190, 24, 24, [this]() { this->ToggleCard(7); } },
 		{ 320, 190, 24, 24, [this]() { this->ToggleCard(8); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
+	PageGrid CardGrid = PageGrid(this->Positions, 2, 9), BoxGrid = PageGrid(this->Positions, 11, 9);
+	GFX::CardBatch Batch;
 
 	const std::vector<FuncCallback> BottomPos = {
 		{ 0, 15, 25, 215, [this]() { this->PrevPage(); } },
@@ -105,6 +118,8 @@ private:
 		{ 45, 10, 110, 26, [this]() { this->SelectAll(); } },
 		{ 165, 10, 110, 26, [this]() { this->SelectNone(); } }
 	};
+	const HitIndex BottomPosIndex = HitIndex(this->BottomPos);
+	PageGrid BottomGrid = PageGrid(this->BottomPos, 2, 9, 320);
 };
 
 #endif
\ No newline at end of file
@@ -27,6 +27,10 @@
 #ifndef _3DZWEI_CARDSET_SELECTOR_HPP
 #define _3DZWEI_CARDSET_SELECTOR_HPP
 
+#include "GFX.hpp" // Card batches.
+#include "Gesture.hpp" // Card page drags.
+#include "HitIndex.hpp"
+#include "PageGrid.hpp" // Visible cards.
 #include "Pointer.hpp"
 #include <citro2d.h>
 #include <string>
@@ -37,7 +41,7 @@ public:
 	CardSetSelector();
 	std::string Action();
 private:
-	bool Done = false, FullDone = false, Res = false, SetGood = false, FadeIn = true,
+	bool Done = false, Res = false, SetGood = false, FadeIn = true,
 		IsSelecting = true, ModeSwitch = false, InitialSwipe = true;
 	int16_t FAlpha = 255;
 
@@ -48,8 +52,9 @@ private:
 	/* Preview based. */
 	C2D_SpriteSheet PreviewSheet = nullptr;
 	bool FlipCard = false, FirstFlipDone = false, CardSwipeDir = false, CardSwipe = false,
-		CardSwipeIn = false, CardSwipeOut = false;
+		CardSwipeIn = false, CardSwipeOut = false, CardDrag = false, CardSwipeBack = false;
 	int CardPage = 0, PrevCardPos = -400, CurCardPos = -400, NextCardPos = 400, ToFlip = -1;
+	Gesture Touch;
 
 	/* Animation related. */
 	float Cubic = 0.0f;
@@ -68,6 +73,9 @@ private:
 	void PrevCardPage();
 	void NextCardPage();
 	bool CardCanGoNext() const;
+	void MoveCardPages();
+	void DragCardPage(const float DX);
+	void DropCardPage(const bool Switch);
 	void ToggleCard(const uint8_t Idx);
 	void DrawCardPage(const size_t Pg, const int AddOffs);
 	void DrawCardBottom(const int AddOffs);
@@ -97,6 +105,9 @@ private:
 		{ 160, 175, 55, 55, [this]() { this->ToggleCard(7); } },
 		{ 260, 175, 55, 55, [this]() { this->ToggleCard(8); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
+	PageGrid CardGrid = PageGrid(this->Positions, 2, 9);
+	GFX::CardBatch Batch;
 
 	const std::vector<FuncCallback> SetPos = {
 		{ 0, 15, 25, 215, [this]() { this->PrevSetPage(); } },
@@ -109,6 +120,7 @@ private:
 
 		{ 295, 15, 25, 215, [this]() { this->NextSetPage(); } }
 	};
+	const HitIndex SetPosIndex = HitIndex(this->SetPos);
 
 
 	const std::vector<FuncCallback> BottomPos = {
@@ -130,6 +142,8 @@ private:
 		{ 45, 210, 110, 25, [this]() { this->Cancel(); } },
 		{ 165, 210, 110, 25, [this]() { this->Confirm(); } }
 	};
+	const HitIndex BottomPosIndex = HitIndex(this->BottomPos);
+	PageGrid BottomGrid = PageGrid(this->BottomPos, 2, 9, 320);
 };
 
 #endif
\ No newline at end of file
@@ -27,25 +27,43 @@
 #ifndef _3DZWEI_CHARACTER_SELECTOR_HPP
 #define _3DZWEI_CHARACTER_SELECTOR_HPP
 
+#include "Gesture.hpp" // Page drags.
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
+#include "Scene.hpp" // Pages.
 #include <string>
 #include <vector>
 
 class CharacterSelector {
 public:
-	CharacterSelector(const int OldSelection) : Res(OldSelection) { }
+	CharacterSelector(const int OldSelection) : Res(OldSelection) {
+		this->PageNodes[0] = this->Pages.AddNode();
+		this->PageNodes[1] = this->Pages.AddNode();
+	}
 	int Action();
 private:
 	size_t Page = 0;
 	int Res = 0, PrevPos = -320, CurPos = -320, NextPos = 320;
-	bool Done = false, FullDone = false, FadeIn = true, SwipeDir = true, DoSwipe = false, InitialSwipe = true;
+	bool Done = false, FadeIn = true, SwipeDir = true, DoSwipe = false, InitialSwipe = true,
+		Dragging = false, SwipeBack = false;
 	float Cubic = 0.0f;
+	Gesture Touch;
 	int16_t FAlpha = 255;
 
-	void DrawPage(const size_t Page, const int AddOffs);
+	/* The current page and the swipe target as scene nodes, which are only built again if their page changed. */
+	Scene Pages;
+	Scene::NodeID PageNodes[2] = { 0, 0 };
+	size_t BuiltPages[2] = { SIZE_MAX, SIZE_MAX };
+
+	void BuildPage(const uint8_t Node, const size_t Page);
+	void DrawPages();
+	void Draw();
 	void SelectCharacter(const uint8_t Idx);
 	void PrevPage();
 	void NextPage();
+	void MovePages();
+	void DragPage(const float DX);
+	void DropPage(const bool Switch);
 	bool CanGoNext() const;
 	void Cancel();
 	void Handler();
@@ -54,6 +72,7 @@ private:
 		{ 0, 15, 25, 215, [this]() { this->PrevPage(); } },
 		{ 295, 15, 25, 215, [this]() { this->NextPage(); } }
 	};
+	const HitIndex BottomPosIndex = HitIndex(this->BottomPos);
 
 	const std::vector<FuncCallback> Characters = {
 		{ 40, 9, 48, 48, [this]() { this->SelectCharacter(0); } },
@@ -76,6 +95,7 @@ private:
 		{ 166, 180, 48, 48, [this]() { this->SelectCharacter(14); } },
 		{ 229, 180, 48, 48, [this]() { this->SelectCharacter(15); } }
 	};
+	const HitIndex CharactersIndex = HitIndex(this->Characters);
 };
 
 #endif
\ No newline at end of file
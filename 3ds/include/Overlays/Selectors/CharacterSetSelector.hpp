@@ -27,6 +27,7 @@
 #ifndef _3DZWEI_CHARACTERSET_SELECTOR_HPP
 #define _3DZWEI_CHARACTERSET_SELECTOR_HPP
 
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include <citro2d.h>
 #include <string>
@@ -37,7 +38,7 @@ public:
 	CharacterSetSelector();
 	std::string Action();
 private:
-	bool Done = false, FullDone = false, Res = false, SetGood = false, FadeIn = true,
+	bool Done = false, Res = false, SetGood = false, FadeIn = true,
 		IsSelecting = true, ModeSwitch = false, InitialSwipe = true;
 	int16_t FAlpha = 255;
 
@@ -81,6 +82,7 @@ private:
 		{ 0, 25, 20, 215, [this]() { this->PrevChar(); } },
 		{ 380, 25, 20, 215, [this]() { this->NextChar(); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
 
 	const std::vector<FuncCallback> SetPos = {
 		{ 0, 15, 25, 215, [this]() { this->PrevSetPage(); } },
@@ -93,6 +95,7 @@ private:
 
 		{ 295, 15, 25, 215, [this]() { this->NextSetPage(); } }
 	};
+	const HitIndex SetPosIndex = HitIndex(this->SetPos);
 
 
 	const std::vector<FuncCallback> BottomPos = {
@@ -102,6 +105,7 @@ private:
 		{ 45, 94, 110, 48, [this]() { this->Cancel(); } },
 		{ 165, 94, 110, 48, [this]() { this->Confirm(); } }
 	};
+	const HitIndex BottomPosIndex = HitIndex(this->BottomPos);
 };
 
 #endif
\ No newline at end of file
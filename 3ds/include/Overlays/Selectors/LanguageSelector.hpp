@@ -27,6 +27,7 @@
 #ifndef _3DZWEI_LANGUAGE_SELECTOR_HPP
 #define _3DZWEI_LANGUAGE_SELECTOR_HPP
 
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include <vector>
 
@@ -56,5 +57,6 @@ private:
 
 		{ 0, 223, 17, 17, [this]() { this->Cancel(); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
 };
 #endif
\ No newline at end of file
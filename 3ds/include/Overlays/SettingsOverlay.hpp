@@ -27,6 +27,7 @@
 #ifndef _3DZWEI_SETTINGS_OVERLAY_HPP
 #define _3DZWEI_SETTINGS_OVERLAY_HPP
 
+#include "HitIndex.hpp"
 #include "Pointer.hpp"
 #include <vector>
 
@@ -39,7 +40,7 @@ private:
 
 	SettingsTab Tab = SettingsTab::Configuration;
 	const std::vector<std::string> TabNames = { "SETTINGS_TAB_CONFIG", "SETTINGS_ANIMATION_TAB", "SETTINGS_TAB_APPINFO" };
-	bool Done = false, SwipeDir = false, DoSwipe = false, InitialSwipe = true, FadeIn = true, FadeOut = false;
+	bool Done = false, SwipeDir = false, DoSwipe = false, InitialSwipe = true, FadeIn = true;
 	int CurTabOffs[3] = { -320, 320, 640 }, PrevTabOffs[3] = { -320, 320, 640 }, FAlpha = 255;
 	float Swipe = 0.0f, ToSwipe = 0.0f;
 
@@ -82,6 +83,7 @@ private:
 
 		{ 0, 223, 17, 17, [this]() { this->Back(); } }
 	};
+	const HitIndex AnimPosIndex = HitIndex(this->AnimPos);
 
 	const std::vector<FuncCallback> Positions = {
 		{ 1, 0, 106, 20, [this]() { this->ConfigTab(); } },
@@ -98,6 +100,7 @@ private:
 
 		{ 0, 223, 17, 17, [this]() { this->Back(); } }
 	};
+	const HitIndex PositionsIndex = HitIndex(this->Positions);
 };
 
 #endif
\ No newline at end of file
@@ -46,9 +46,9 @@ private:
 		FadeOut = 4
 	};
 
-	int16_t FAlpha = 255;
-	int16_t X = 200, Y = 120; // Pointer Pos.
-	int16_t CoreMoved = 0; // The Moved Core Logo.
+	float FAlpha = 255.0f;
+	float X = 200.0f, Y = 120.0f; // Pointer Pos.
+	float CoreMoved = 0.0f; // The Moved Core Logo.
 	States State = States::GotoFirst; // The Current State.
 	bool Done = false;
 
@@ -71,7 +71,7 @@ public:
 
 	/* Turn State related things. */
 	TurnState GetState() const { return this->State; } // Gets the Current State.
-	void SetState(const TurnState State) { this->State = State; } // Sets the Current State.
+	void SetState(const TurnState State);
 
 	/* Player related things. */
 	Players GetCurrentPlayer() const { return this->CurrentPlayer; } // Gets the Current Player.
@@ -84,8 +84,14 @@ public:
 	AIMethod GetMethod() const;
 
 	/* Returns the Turn cards. */
-	int GetTurnCard(const uint8_t Idx) const { return this->PlayCards[Idx]; }
+	int GetTurnCard(const uint8_t Idx) const { return (Idx < 2 ? this->PlayCards[Idx] : -1); }
 	void ResetTurn(const bool Correct);
+
+	/* Consistency check, which the setters use to refuse inconsistent changes. */
+	bool CheckIntegrity() const;
+
+	/* Seeds the Random Engine, so a shuffle and the AI picks can be repeated. */
+	void SetSeed(const uint32_t Seed) { this->RandomEngine.seed(Seed); }
 private:
 	std::mt19937 RandomEngine;
 
@@ -126,7 +132,8 @@ private:
 
 	bool AIUsed = false; // If an AI is used.
 	size_t Pairs = 0, PlayerPairs[2] = { 0 }; // The amount of Pairs of the current game + pairs from the players.
-	int PlayCards[2] = { -1 }; // The play cards containing the indexes of the current turn.
+	int PlayCards[2] = { -1, -1 }; // The play cards containing the indexes of the current turn.
+	bool Checked = false; // If DoCheck already handled the current turn, so a pair doesn't get counted twice.
 	std::unique_ptr<AI> _AI = nullptr; // The AI used in the current Game.
 	std::vector<CardStruct> Gamefield = { }; // The Game's field.
 	Players CurrentPlayer = Players::Player1; // The Current Player.
@@ -0,0 +1,80 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_ANIMATOR_HPP
+#define _3DZWEI_ANIMATOR_HPP
+
+#include <cstdint> // uint8_t, uint32_t.
+#include <functional> // std::function.
+#include <vector> // Tweens.
+
+/*
+	A small tween scheduler.
+
+	Every tween moves a float from one value to another over a fixed amount of 60 FPS frames with an easing curve.
+	Tick() has to be called ONCE per frame from the owner's loop with the passed frames, so animations run side by side
+	with input and logic instead of blocking in their own loop, and still finish on time if a frame took longer.
+*/
+class Animator {
+public:
+	enum class Ease : uint8_t { Linear = 0, OutQuad = 1, OutCubic = 2, InOutCubic = 3 };
+
+	void Add(float &Value, const float From, const float To, const uint32_t Frames, const Ease Type = Ease::OutCubic,
+		const std::function<void()> &Done = nullptr, const uint8_t Group = 0, const uint32_t Delay = 0);
+
+	void CancelGroup(const uint8_t Group, const bool Finish = false);
+	void Clear() { this->Tweens.clear(); } // Drops all tweens without calling their callbacks.
+
+	bool GroupActive(const uint8_t Group) const;
+	bool Busy() const { return !this->Tweens.empty(); }
+
+	void Tick(const float Frames = 1.0f);
+private:
+	/*
+		float *Value: The value to animate.
+		float From, To: Start and end value.
+		float Frames, Elapsed, Delay: The duration, the passed frames and the frames to wait before starting.
+		uint32_t Born: The tick in which the tween got added, so tweens added from a callback start with the next tick.
+		std::function<void()> Done: Called once the tween finished.
+	*/
+	struct Tween {
+		float *Value;
+		float From, To;
+		float Frames, Elapsed, Delay;
+		uint32_t Born;
+		Ease Type;
+		uint8_t Group;
+		std::function<void()> Done;
+	};
+
+	std::vector<Tween> Tweens = { };
+	uint32_t Ticks = 0;
+
+	static float Apply(const Ease Type, const float T);
+	void Finish(const size_t Idx, const bool CallDone);
+};
+
+#endif
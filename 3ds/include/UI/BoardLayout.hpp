@@ -0,0 +1,68 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_BOARD_LAYOUT_HPP
+#define _3DZWEI_BOARD_LAYOUT_HPP
+
+#include <cstddef> // size_t.
+#include <cstdint> // uint8_t.
+#include <span> // Waves.
+
+/*
+	Computes the card rectangles of the Gamefield from the grid dimensions.
+
+	The cards are placed as large as possible into the area between both page buttons, centered and with a gap of 1 pixel.
+	A 5x4 grid results in the original 55x55 cards, denser grids scale the cards down and fit more of them on a page.
+	Hit-testing is done arithmetic from the grid, instead of checking every card rectangle.
+
+	The waves of the falling Start Animation are the diagonals of the grid, starting at the bottom right card.
+	They're generated at compile time for every grid, so they work for any card count without hand-written tables.
+*/
+class BoardLayout {
+public:
+	enum class Grid : uint8_t { Normal = 0, Dense = 1, Denser = 2 }; // 5x4, 6x4, 8x5.
+	struct Rect { float X, Y, W, H; };
+
+	BoardLayout(const Grid G = Grid::Normal);
+
+	uint8_t Cols() const { return this->VCols; }
+	uint8_t Rows() const { return this->VRows; }
+	size_t PerPage() const { return (size_t)this->VCols * this->VRows; }
+	size_t Pages(const size_t Cards) const { return (Cards + this->PerPage() - 1) / this->PerPage(); }
+
+	float Scale() const; // The scale of the card sprites.
+	Rect Card(const size_t Slot) const;
+	int Slot(const float X, const float Y) const;
+
+	size_t WaveCount(const size_t Cards) const;
+	std::span<const uint8_t> Wave(const size_t Idx, const size_t Cards) const;
+private:
+	uint8_t VCols = 5, VRows = 4;
+	const uint8_t *WaveSlots = nullptr, *WaveStart = nullptr; // The slots sorted by diagonal and where each diagonal starts.
+	float Pitch = 56.0f, OriginX = 20.5f, OriginY = 8.5f; // The distance between two cards and the first card position.
+};
+
+#endif
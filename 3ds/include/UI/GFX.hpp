@@ -29,6 +29,7 @@
 
 #include "screenCommon.hpp"
 #include "sprites.h"
+#include <string>
 #include <vector>
 
 #define BAR_BLUE   C2D_Color32(36, 52, 81, 255)    // Darker Blue.
@@ -38,15 +39,69 @@
 namespace GFX {
 	extern C2D_SpriteSheet Cards, Characters, Sprites;
 
+	/*
+		Frame statistics since the start or the last reset.
+
+		uint32_t Drawn: The drawn frames.
+		uint32_t Skipped: The loop steps without a change, that only waited for the VBlank.
+		uint32_t Idle: The skipped steps, which waited longer in the low power mode.
+		float AvgMs, MaxMs: The time from GFX::BeginFrame() to GFX::EndFrame() of the drawn frames.
+	*/
+	struct FrameStats { uint32_t Drawn = 0, Skipped = 0, Idle = 0; float AvgMs = 0.0f, MaxMs = 0.0f; };
+
 	void LoadSheets();
 	void UnloadSheets();
 
+	/* Frame related. */
+	void Invalidate();
+	bool Changed();
+	bool BeginFrame();
+	bool BeginFrame(const bool Draw);
+	void EndFrame();
+	FrameStats GetFrameStats();
+	void ResetFrameStats();
+
+	void ScreenDraw(C3D_RenderTarget *Screen);
+	C3D_RenderTarget *Redirect(C3D_RenderTarget *Screen, C3D_RenderTarget *Target);
 	void DrawTop();
 	void DrawBottom();
 
+	/* Cached text drawing, with the same parameters as Gui::DrawString(Centered). */
+	void DrawString(const float X, const float Y, const float Size, const uint32_t Color, const std::string &Text, const int MaxWidth = 0, const int MaxHeight = 0, C2D_Font Fnt = nullptr, const int Flags = 0);
+	void DrawStringCentered(const float X, const float Y, const float Size, const uint32_t Color, const std::string &Text, const int MaxWidth = 0, const int MaxHeight = 0, C2D_Font Fnt = nullptr, const int Flags = 0);
+	bool CacheText(const std::string &Text);
+	void ClearTextCache();
+	void UnloadText();
+
 	void DrawCornerEdge(const bool LeftSide, const int XPos, const int YPos, const int YSize, const bool DrawArrow = true);
 	void DrawCheckbox(const int PosX, const int PosY, const bool Checked = false, const bool OnList = false);
 	void DrawCard(const size_t Idx, const int X, const int Y, const float ScaleX = 1.0f, const float ScaleY = 1.0f);
+
+	/*
+		Collects the cards of a sprite sheet and draws them together, instead of looking up each sprite on its own.
+
+		The back cover is the last sprite of a sheet and the same for every hidden card, so its image is only fetched once
+		per Draw() and all back covers are submitted as instances of it. The fronts follow, so the sheet texture stays bound
+		for the whole batch. Cards of a batch must not overlap, as the backs are drawn before the fronts.
+	*/
+	class CardBatch {
+	public:
+		void Add(const size_t Idx, const float X, const float Y, const float ScaleX = 1.0f, const float ScaleY = 1.0f);
+		void AddBack(const float X, const float Y, const float ScaleX = 1.0f, const float ScaleY = 1.0f);
+		void Draw(C2D_SpriteSheet Sheet = GFX::Cards);
+		void Clear();
+		bool Empty() const { return this->Fronts.empty() && this->Backs.empty(); };
+	private:
+		/*
+			size_t Idx: The sprite index of the sheet, unused for back covers.
+			float X, Y: The position.
+			float ScaleX, ScaleY: The scale.
+		*/
+		struct Instance { size_t Idx; float X, Y, ScaleX, ScaleY; };
+
+		/* Reused for every batch, so they don't allocate after the first frames. */
+		std::vector<Instance> Fronts = { }, Backs = { };
+	};
 }
 
 #endif
\ No newline at end of file
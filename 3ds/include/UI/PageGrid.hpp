@@ -0,0 +1,62 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_PAGE_GRID_HPP
+#define _3DZWEI_PAGE_GRID_HPP
+
+#include "Pointer.hpp" // FuncCallback.
+#include <functional>
+#include <vector>
+
+/*
+	A paged grid over a list of items, like the cards of a sheet.
+
+	The cell rectangles of one page come from the callback positions of an overlay, starting at a first index.
+	Drawing a page only visits the existing items of that page, and skips the cells which are moved out of the screen
+	by a swipe offset. So a page, which is fully swiped out, costs nothing, no matter how large the list is.
+	The cells are only referenced, so they have to live as long as the grid, like the const members of an overlay.
+*/
+class PageGrid {
+public:
+	PageGrid(const std::vector<FuncCallback> &Cells, const size_t First, const size_t PerPage, const uint16_t Width = 400, const uint16_t Height = 240);
+
+	void Resize(const size_t Items) { this->Items = Items; }
+	size_t Size() const { return this->Items; }
+	size_t PerPage() const { return this->Slots; }
+
+	bool HasPage(const size_t Page) const { return (Page * this->Slots < this->Items); }
+	size_t PageOf(const size_t Idx) const { return Idx / this->Slots; }
+	int Index(const size_t Page, const size_t Slot) const;
+	bool Contains(const int Cell) const { return (Cell >= (int)this->First && Cell < (int)(this->First + this->Slots)); }
+
+	void Draw(const size_t Page, const float OffsX, const float OffsY, const std::function<void(const size_t Idx, const size_t Slot, const float X, const float Y)> &Func) const;
+private:
+	const std::vector<FuncCallback> &Cells;
+	size_t First = 0, Slots = 1, Items = 0;
+	uint16_t Width = 400, Height = 240;
+};
+
+#endif
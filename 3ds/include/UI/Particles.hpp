@@ -0,0 +1,55 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_PARTICLES_HPP
+#define _3DZWEI_PARTICLES_HPP
+
+#include <array> // Particle data.
+#include <cstddef> // size_t.
+#include <cstdint> // uint32_t.
+
+/*
+	A fixed pool of small particles, like card fragments or confetti.
+
+	The particle data is kept as one array per value, so Tick() updates all particles in one pass over plain floats.
+	Nothing gets allocated: A burst only uses the free slots, so a frame never updates or draws more than MAX particles.
+*/
+class Particles {
+public:
+	static constexpr size_t MAX = 128;
+
+	void Burst(const float X, const float Y, const size_t Amount, const float Speed, const uint32_t *Colors, const size_t ColorCount);
+	void Tick(const float Frames = 1.0f);
+	void Draw() const;
+	void Clear() { this->Count = 0; };
+	bool Active() const { return this->Count > 0; };
+private:
+	size_t Count = 0; // The first Count particles are alive.
+	std::array<float, MAX> X, Y, VX, VY, Life, Size;
+	std::array<uint32_t, MAX> Color;
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_RENDER_TEXTURE_HPP
+#define _3DZWEI_RENDER_TEXTURE_HPP
+
+#include <citro2d.h>
+
+/*
+	A VRAM texture, which can be drawn on like a screen and then drawn as a single quad.
+	The texture needs power of 2 sizes, so only the top left part of it is used.
+*/
+class RenderTexture {
+public:
+	RenderTexture(const uint16_t Width = 400, const uint16_t Height = 240) : Width(Width), Height(Height) { };
+	~RenderTexture();
+
+	bool Init();
+	C3D_RenderTarget *Target() const { return this->VTarget; };
+	void Draw(const float X, const float Y, const float Alpha = 1.0f);
+private:
+	uint16_t Width = 400, Height = 240;
+	C3D_Tex Tex;
+	Tex3DS_SubTexture SubTex;
+	C3D_RenderTarget *VTarget = nullptr;
+};
+
+#endif
@@ -0,0 +1,85 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_SCENE_HPP
+#define _3DZWEI_SCENE_HPP
+
+#include <citro2d.h>
+#include <vector>
+
+/*
+	A lightweight retained scene graph.
+
+	Nodes hold sprites and rectangles relative to their position and can have child nodes. The contents stay until they are
+	changed, so moving a whole subtree (like a page swipe) is a single SetPos() call.
+
+	Draw() collects all visible items and sorts them by layer, sprite sheet and sprite, so items with the same texture get
+	submitted together and equal sprites (like the card back covers) share one image lookup. Items of the same layer must
+	not overlap, as their order is not kept.
+*/
+class Scene {
+public:
+	using NodeID = size_t;
+	static constexpr NodeID Root = 0;
+
+	Scene() { this->Nodes.emplace_back(); };
+
+	NodeID AddNode(const NodeID Parent = Root);
+	void SetPos(const NodeID Node, const float X, const float Y);
+	void SetVisible(const NodeID Node, const bool Visible);
+
+	void Clear(const NodeID Node);
+	void Sprite(const NodeID Node, const uint8_t Layer, C2D_SpriteSheet Sheet, const size_t Idx, const float X, const float Y, const float ScaleX = 1.0f, const float ScaleY = 1.0f);
+	void Rect(const NodeID Node, const uint8_t Layer, const float X, const float Y, const float W, const float H, const uint32_t Color);
+
+	void Draw();
+private:
+	/*
+		C2D_SpriteSheet Sheet: The sheet of a sprite, nullptr for rectangles.
+		size_t Idx: The sprite index, or the color of a rectangle.
+		float W, H: The scale of a sprite, or the size of a rectangle.
+	*/
+	struct Item {
+		uint8_t Layer;
+		C2D_SpriteSheet Sheet;
+		size_t Idx;
+		float X, Y, W, H;
+	};
+
+	struct Node {
+		float X = 0.0f, Y = 0.0f;
+		bool Visible = true;
+		std::vector<NodeID> Children = { };
+		std::vector<Item> Items = { };
+	};
+
+	std::vector<Node> Nodes = { };
+	std::vector<Item> Queue = { }; // Reused for every Draw(), so it doesn't allocate after the first frames.
+
+	void Collect(const NodeID Node, const float X, const float Y);
+};
+
+#endif
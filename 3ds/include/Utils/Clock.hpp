@@ -0,0 +1,44 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_CLOCK_HPP
+#define _3DZWEI_CLOCK_HPP
+
+/*
+	The frame clock for time based animations.
+
+	Animations are tuned for 60 FPS, so Frames() returns the passed time in 60 FPS frames (1.0f on a normal frame).
+	If a frame takes longer, animations move further in one step, so they still finish on time.
+*/
+namespace Clock {
+	void Tick(const bool Fixed = false);
+	float Frames();
+	double Now();
+	float Lerp(const float A, const float B, const float Rate);
+	int Step(const int PerFrame);
+}
+
+#endif
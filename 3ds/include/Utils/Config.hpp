@@ -77,6 +77,10 @@ public:
 	bool DoFade() const { return this->VDoFade; }
 	void DoFade(const bool V) { this->VDoFade = V; if (!this->ChangesMade) this->ChangesMade = true; }
 
+	/* The grid of the Gamefield. 0: 5x4, 1: 6x4, 2: 8x5. */
+	uint8_t BoardGrid() const { return this->VBoardGrid; }
+	void BoardGrid(const uint8_t V) { this->VBoardGrid = (V > 2 ? 0 : V); if (!this->ChangesMade) this->ChangesMade = true; }
+
 	void FetchDefaults();
 	GameSettings::GameParams GetDefault() const { return this->VDefaultParams; }
 	void SetDefault(const GameSettings::GameParams &Defaults);
@@ -99,7 +103,7 @@ private:
 	GameSettings::GameParams VDefaultParams; // Store default game settings as well into config.
 	bool ChangesMade = false, VShowSplash = true, VAnimation = true, VPageSwitch = true, VDoFade = true;
 	nlohmann::json CFG = nullptr;
-	uint8_t VPointerSpeed = 4, VGameAnimation = 1;
+	uint8_t VPointerSpeed = 4, VGameAnimation = 1, VBoardGrid = 0;
 	std::string VCardSet = "3DZwei-RomFS", VCharSet = "3DZwei-RomFS", VLang = "en";
 };
 
@@ -0,0 +1,73 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_GESTURE_HPP
+#define _3DZWEI_GESTURE_HPP
+
+#include <3ds.h> // touchPosition.
+
+/*
+	Turns the touch of each frame into taps, drags, swipes, flicks and long presses.
+
+	Update() has to be called once per frame after Input::Scan(), with the live touch and not a queued one.
+	A drag starts on the first frame the finger moved further than a few pixels, so pages can follow the finger right away.
+	Only the pages wait for a tap, so a drag can start on them. Anything else acts on the press and cancels the gesture.
+	Distances are in pixels, the velocity in pixels per 60 FPS frame, so it's the same on a slow frame or a script playback.
+*/
+class Gesture {
+public:
+	enum class Type : uint8_t {
+		None = 0,
+		Press = 1, // The first frame of a touch.
+		Drag = 2, // Every frame of a drag, once the finger got further than the slop.
+		Tap = 3, // Released without moving.
+		LongPress = 4, // Held still for a while. No Tap follows on release.
+		Swipe = 5, // Released after a drag far enough.
+		Flick = 6, // Released after a short, but fast drag.
+		Release = 7 // Released after a drag, that was neither a swipe nor a flick.
+	};
+
+	Type Update(const uint32_t Held, const touchPosition &T);
+	void Cancel();
+
+	bool Dragging() const { return (this->CurState == State::Dragging); }
+	float StartX() const { return this->SX; }
+	float StartY() const { return this->SY; }
+	touchPosition Start() const { return { (u16)this->SX, (u16)this->SY }; }
+	float DX() const { return this->X - this->SX; }
+	float DY() const { return this->Y - this->SY; }
+	float Velocity() const { return this->VX; }
+private:
+	enum class State : uint8_t { Idle = 0, Pressed = 1, Dragging = 2, Held = 3, Ignored = 4 };
+
+	State CurState = State::Idle;
+	float SX = 0.0f, SY = 0.0f, X = 0.0f, Y = 0.0f, VX = 0.0f;
+	float HeldFrames = 0.0f;
+
+	Type Released();
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_HIT_INDEX_HPP
+#define _3DZWEI_HIT_INDEX_HPP
+
+#include "Pointer.hpp" // FuncCallback.
+#include <vector>
+
+/*
+	A uniform grid over a screen, which knows the callbacks overlapping each cell.
+
+	It's built once from the callback positions of an overlay. A click or touch then only checks the few callbacks
+	of its cell instead of all of them. Like the loops it replaces, the first matching callback in the list wins.
+	The callbacks are only referenced, so they have to live as long as the index, like the const members of an overlay.
+*/
+class HitIndex {
+public:
+	HitIndex(const std::vector<FuncCallback> &Callbacks, const uint16_t Width = 400, const uint16_t Height = 240);
+
+	int Find(const float X, const float Y) const;
+	bool Clicked(const bool CallFunc = true) const;
+	bool Touched(const touchPosition &T, const bool CallFunc = true) const;
+private:
+	const std::vector<FuncCallback> &Callbacks;
+	uint8_t Cols = 0, Rows = 0;
+	std::vector<uint16_t> Start = { }; // The first entry of each cell in Entries, the cell's entries end at the next start.
+	std::vector<uint8_t> Entries = { }; // The callback indexes of all cells.
+
+	size_t Cell(const float X, const float Y) const;
+};
+
+#endif
@@ -0,0 +1,74 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_INPUT_HPP
+#define _3DZWEI_INPUT_HPP
+
+#include <3ds.h> // touchPosition, circlePosition.
+#include <string>
+
+/*
+	The input source of all overlays.
+
+	By default this just forwards the HID state of the current frame. If a script got loaded,
+	the key and touch state is played back from it instead, frame by frame, so the same inputs can be
+	replayed deterministically and the input-to-visible-change latency can be measured.
+*/
+namespace Input {
+	void Scan();
+	uint32_t Down();
+	uint32_t Held();
+	uint32_t Repeat();
+	uint32_t ScanFrame();
+	void TouchRead(touchPosition *T);
+	void CircleRead(circlePosition *C);
+
+	/*
+		A press of a frame. Each Scan() with pressed or repeated keys queues one, so a press made while the consumer
+		is busy (e.g. an animation) stays until it gets polled.
+
+		Most loops handle a press in its own frame through Down(), so the presses of the previous frames are dropped with the
+		next Scan(). Only while Queue(true) is set, like during a game, they stay queued across frames.
+
+		uint32_t Down, Repeat: The pressed and repeated keys of the frame.
+		touchPosition Touch: The touch position of the frame.
+		uint32_t Frame: The frame it got scanned on.
+		uint64_t Tick: The system tick it got scanned at.
+	*/
+	struct Event { uint32_t Down; uint32_t Repeat; touchPosition Touch; uint32_t Frame; uint64_t Tick; };
+
+	bool Poll(Event &E, const uint32_t MaxAge = 30);
+	void Flush();
+	void Queue(const bool Keep);
+
+	/* Scripted playback and latency measurement. */
+	bool LoadScript(const std::string &File);
+	bool Playback();
+	void Presented(const char *Tag, const uint32_t PressFrame);
+	void WriteReport(const std::string &File);
+}
+
+#endif
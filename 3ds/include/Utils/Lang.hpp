@@ -27,11 +27,13 @@
 #ifndef _3DZWEI_LANG_HPP
 #define _3DZWEI_LANG_HPP
 
+#include "LangStrings.h" // Generated from the english strings by the Makefile.
 #include <string>
 
 namespace Lang {
-	std::string Get(const std::string &Key);
+	const std::string &Get(const Str ID);
 	void Load();
+	bool Prewarm(const size_t Amount = 8);
 }
 
 #endif
\ No newline at end of file
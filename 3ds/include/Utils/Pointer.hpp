@@ -43,15 +43,19 @@ namespace Pointer {
 	extern float X, Y;
 	extern bool OnTop, Show;
 
-	bool Clicked(const FuncCallback CBack, const bool CallFunc = true);
+	bool Clicked(const FuncCallback &CBack, const bool CallFunc = true);
 	void ScrollHandling(const uint32_t Held, const bool InGame = false);
 
+	float HitX();
+	float HitY();
+
 	void Draw();
-	void SetPos(const FuncCallback CBack);
+	void Draw(const float X, const float Y);
+	void SetPos(const FuncCallback &CBack);
 	void SetPos(const float X, const float Y);
 }
 
 /* This isn't really pointer related, but also kinda FuncCallback related which is declared at this file. */
-bool Touched(const FuncCallback CBack, touchPosition T, const bool CallFunc = true);
+bool Touched(const FuncCallback &CBack, const touchPosition &T, const bool CallFunc = true);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_TIMER_HPP
+#define _3DZWEI_TIMER_HPP
+
+#include <cstdint> // uint32_t.
+
+/*
+	A non-blocking deadline timer.
+
+	Instead of waiting inside a loop, the timer gets started once and then polled by the main loop each frame,
+	so drawing and input keep running during the wait. The deadline is counted in Clock frames, so it follows the logic
+	steps and a scripted playback gets the same delays on every run.
+*/
+class Timer {
+public:
+	void Start(const uint32_t Frames);
+	void Stop() { this->IsArmed = false; }
+
+	bool Armed() const { return this->IsArmed; }
+	bool Expired() const;
+private:
+	double Deadline = 0.0;
+	bool IsArmed = false;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#ifndef _3DZWEI_TRIPLE_BUFFER_HPP
+#define _3DZWEI_TRIPLE_BUFFER_HPP
+
+#include <atomic> // Buffer exchange.
+#include <cstdint> // uint8_t.
+
+/*
+	A lock-free triple buffer to pass state from ONE writer thread to ONE reader thread.
+
+	The writer fills Back() and publishes it, the reader picks up the latest published buffer with Acquire() and reads Front().
+	Neither side ever waits for the other: If the writer publishes faster than the reader reads, older buffers are just replaced.
+	Published buffers get reused later, so the writer always has to fill the whole buffer.
+*/
+template <typename T>
+class TripleBuffer {
+public:
+	/* Writer side. */
+	T &Back() { return this->Buffers[this->BackIdx]; };
+
+	void Publish() {
+		const uint8_t Prev = this->Middle.exchange(this->BackIdx | FRESH, std::memory_order_acq_rel);
+		this->BackIdx = (Prev & INDEX);
+	};
+
+	/* Reader side. Returns true, if a newer buffer got published since the last call. */
+	bool Acquire() {
+		if (!(this->Middle.load(std::memory_order_acquire) & FRESH)) return false;
+
+		const uint8_t Prev = this->Middle.exchange(this->FrontIdx, std::memory_order_acq_rel);
+		this->FrontIdx = (Prev & INDEX);
+		return true;
+	};
+
+	const T &Front() const { return this->Buffers[this->FrontIdx]; };
+private:
+	static constexpr uint8_t INDEX = 0x3, FRESH = 0x4; // The index of the middle buffer and if it's not read yet.
+
+	T Buffers[3];
+	uint8_t BackIdx = 0, FrontIdx = 1; // Only touched by the writer or reader.
+	std::atomic<uint8_t> Middle = 2;
+};
+
+#endif
@@ -26,6 +26,8 @@
 
 #include "3DZwei.hpp"
 #include "Common.hpp"
+#include "Stats.hpp"
+#include "Transition.hpp"
 #include "Utils.hpp"
 #include <3ds.h> // aptMainLoop().
 #include <dirent.h> // mkdir.
@@ -40,6 +42,13 @@
 #include "SplashOverlay.hpp"
 
 std::unique_ptr<Config> _3DZwei::CFG = nullptr;
+static aptHookCookie AptCookie;
+
+
+/* The screens need to be redrawn, when the app comes back. */
+static void AptCallback(APT_HookType Hook, void *Param) {
+	if (Hook == APTHOOK_ONRESTORE || Hook == APTHOOK_ONWAKEUP) GFX::Invalidate();
+}
 
 
 /* Constructor of the app. */
@@ -60,6 +69,7 @@ _3DZwei::_3DZwei() {
 
 	_3DZwei::CFG = std::make_unique<Config>();
 	Lang::Load();
+	Stats::Load();
 	GFX::LoadSheets();
 
 	Utils::LoadCardSet(CFG->CardSet());
@@ -73,7 +83,10 @@ _3DZwei::_3DZwei() {
 		Ovl->Action();
 	}
 
+	Lang::Prewarm(SIZE_MAX); // The rest the splash didn't cache, or all of them, if it's disabled.
+	aptHook(&AptCookie, AptCallback, nullptr); // Redraw after the Home Menu or sleep mode.
 	hidSetRepeatParameters(25, 5);
+	Input::LoadScript("sdmc:/3ds/ut-games/3DZwei/Input.txt"); // Only exists for benchmarks.
 	srand(time(nullptr)); // Seed for rand() usage on animation.
 }
 
@@ -129,104 +142,84 @@ void _3DZwei::ShowCredits() {
 
 
 /* Returns back to an overlay. */
-void _3DZwei::OverlayReturn() { this->FadeInHandler(); }
+void _3DZwei::OverlayReturn() {
+	GFX::Invalidate(); // The main menu is shown again.
+	this->FadeInHandler();
+}
 
 
-/* Fade Handlers. */
+/*
+	Fade Handlers.
+	The main menu doesn't change while fading, so it's only rendered once for the transition.
+*/
 void _3DZwei::FadeOutHandler() {
 	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) return;
 
-	this->FadeOut = true;
-	this->FAlpha = 0;
-
-	while(aptMainLoop() && this->FadeOut) {
-		this->Draw();
-
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) this->FAlpha = 255, this->FadeOut = false;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FadeOut = false;
-		}
-	}
+	Transition::Fade([this]() { this->DrawScene(); }, true);
+	this->FAlpha = 255;
 }
 
 
 void _3DZwei::FadeInHandler() {
 	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) return;
 
-	this->FadeIn = true;
-	this->FAlpha = 255;
-
-	while(aptMainLoop() && this->FadeIn) {
-		this->Draw();
-
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) this->FAlpha = 0, this->FadeIn = false;
-
-		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
-
-			if (this->FAlpha <= 0) this->FadeIn = false;
-		}
-	}
+	Transition::Fade([this]() { this->DrawScene(); }, false);
+	this->FAlpha = 0;
 }
 
 
-void _3DZwei::Draw() {
-	Gui::clearTextBufs();
-	C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-	C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-
+/* Draws the main menu without the fade. */
+void _3DZwei::DrawScene() {
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, "3DZwei", 395);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, "3DZwei", 395);
 	Gui::DrawSprite(GFX::Sprites, sprites_logo_idx, 72, 69); // Display Logo.
-	if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
 
 	GFX::DrawBottom();
 	for (uint8_t Idx = 0; Idx < (int)this->Positions.size(); Idx++) {
 		Gui::Draw_Rect(this->Positions[Idx].X, this->Positions[Idx].Y, this->Positions[Idx].W, this->Positions[Idx].H, BAR_BLUE);
-		Gui::DrawStringCentered(0, this->Positions[Idx].Y + 8, 0.6f, TEXT_WHITE, Lang::Get(this->ButtonNames[Idx]), 130);
+		GFX::DrawStringCentered(0, this->Positions[Idx].Y + 8, 0.6f, TEXT_WHITE, Lang::Get(this->ButtonNames[Idx]), 130);
 	}
 
 	Pointer::Draw();
-	if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-	C3D_FrameEnd(0);
+}
+
+
+void _3DZwei::Draw() {
+	if (!GFX::BeginFrame()) return; // Nothing changed.
+
+	this->DrawScene();
+
+	if (this->FAlpha > 0) {
+		GFX::ScreenDraw(Top);
+		Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+		GFX::ScreenDraw(Bottom);
+		Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
+
+	GFX::EndFrame();
 }
 
 
 /* MAIN Logic. */
 int _3DZwei::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	this->FadeInHandler();
 
 	while(aptMainLoop() && !this->FullExit) {
 		this->Draw();
 
 		if (!this->FullExit) {
-			hidScanInput();
+			Input::Scan();
 			touchPosition T;
-			const uint32_t Down = hidKeysDown();
-			const uint32_t Held = hidKeysHeld();
-			hidTouchRead(&T);
+			const uint32_t Down = Input::Down();
+			const uint32_t Held = Input::Held();
+			Input::TouchRead(&T);
 
 			Pointer::ScrollHandling(Held); // Pointer Handling.
 
-			if (Down & KEY_A) {
-				for (auto &Position : this->Positions) {
-					if (Pointer::Clicked(Position, true)) break;
-				}
-			}
-
-			if (Down & KEY_TOUCH) {
-				for (auto &Position : this->Positions) {
-					if (Touched(Position, T, true)) break;
-				}
-			}
+			if (Down & KEY_A) this->PositionsIndex.Clicked();
+			if (Down & KEY_TOUCH) this->PositionsIndex.Touched(T);
 
 			if (Down & KEY_START) {
 				this->FadeOutHandler();
@@ -237,7 +230,11 @@ int _3DZwei::Action() {
 
 	/* De-init everything. */
 	_3DZwei::CFG->Sav();
+	Stats::Sav();
+	Input::WriteReport("sdmc:/3ds/ut-games/3DZwei/Latency.txt");
+	aptUnhook(&AptCookie);
 	GFX::UnloadSheets();
+	GFX::UnloadText();
 	Gui::exit();
 	romfsExit();
 	gfxExit();
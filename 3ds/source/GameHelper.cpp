@@ -26,9 +26,12 @@
 
 #include "Common.hpp"
 #include "GameHelper.hpp"
+#include "Stats.hpp"
 #include "Utils.hpp"
 
 #define START_ANIMATION_AMOUNT 2
+#define PAIR_PARTICLES        24 // Fragments per card of a collected pair.
+#define TAP_WAIT              30 // Frames a tap during a card animation waits for the next turn.
 
 
 /*
@@ -36,7 +39,11 @@
 
 	Expects a GameSettings::GameParams to start with.
 */
-GameHelper::GameHelper(const GameSettings::GameParams Params) { this->StartGame(false, Params, true); }
+GameHelper::GameHelper(const GameSettings::GameParams Params) {
+	this->PageNodes[0] = this->Field.AddNode();
+	this->PageNodes[1] = this->Field.AddNode();
+	this->StartGame(false, Params, true);
+}
 
 
 /*
@@ -53,6 +60,7 @@ void GameHelper::StartGame(const bool AlreadyInitialized, const GameSettings::Ga
 	} else { // We need to do this way, because the game hasn't been initialized before.
 		this->Params = Params;
 		this->Game = std::make_unique<StackMem>(Utils::Cards.size(), this->Params.AIUsed, this->Params.Method);
+		this->Layout = BoardLayout((BoardLayout::Grid)_3DZwei::CFG->BoardGrid());
 	}
 
 	/* Set the Game Starter, if using Versus Mode. */
@@ -82,159 +90,346 @@ void GameHelper::StartGame(const bool AlreadyInitialized, const GameSettings::Ga
 		}
 	}
 
+	this->CardTimer.Stop(), this->TapTimer.Stop();
+	this->Touch.Cancel(), this->Dragging = false;
+	this->Effects.Clear();
+	this->Round++; // The top screen layer is drawn again.
+
+	/* Reset the round statistics. */
+	this->Turns = 0, this->Misses = 0;
+	this->Starter = this->Game->GetCurrentPlayer();
+
 	/* Set both of them to their initial values. */
 	this->ClickedScale[0] = 1.0f, this->ClickedScale[1] = 1.0f;
 	this->CardClicked[0] = false, this->CardClicked[1] = false;
-	this->Selection = 0;
 	this->Page = 0;
-	Pointer::SetPos(this->CPos[this->Selection].X + 10, this->CPos[this->Selection].Y + 10);
+	this->SelectCard(0);
 	this->StartGameAnimation(); // Initial Animation when starting a game.
+	this->FieldVersion++;
+	GFX::Invalidate();
+}
+
+
+/*
+	Copies everything the draw functions show into a snapshot.
+	This is called by the logic, the draw functions only read from the snapshot afterwards.
+
+	Snapshot &S: The snapshot to fill. Its buffers get reused, so it's filled completely.
+*/
+void GameHelper::Publish(GameHelper::Snapshot &S) const {
+	S.Cards.resize(this->Game->GetPairs() * 2);
+
+	for (size_t Idx = 0; Idx < S.Cards.size(); Idx++) {
+		S.Cards[Idx] = { this->Game->GetCardType(Idx), this->Game->IsCardShown(Idx), this->Game->IsCardCollected(Idx) };
+	}
+
+	for (uint8_t Turn = 0; Turn < 2; Turn++) {
+		S.TurnCards[Turn] = this->Game->GetTurnCard(Turn);
+		S.CardClicked[Turn] = this->CardClicked[Turn];
+		S.ClickedScale[Turn] = this->ClickedScale[Turn];
+		S.Guesses[Turn] = this->Params.Guesses[Turn];
+	}
+
+	S.PlayerPairs[0] = this->Game->GetPlayerPairs(StackMem::Players::Player1);
+	S.PlayerPairs[1] = this->Game->GetPlayerPairs(StackMem::Players::Player2);
+	S.CurrentPlayer = this->Game->GetCurrentPlayer();
+	S.State = this->Game->GetState();
+
+	S.CurPhase = this->CurPhase, S.IntroType = this->IntroType, S.Fade = this->Fade;
+	S.WaveOffset = this->WaveOffset, S.GrowScale = this->GrowScale;
+	S.Page = this->Page, S.SwipeTarget = this->SwipeTarget, S.Swiping = this->Swiping, S.SwipePos = this->SwipePos;
+	S.Round = this->Round, S.FieldVersion = this->FieldVersion;
+	S.Effects = this->Effects;
+
+	/* The pointer is hidden during the AI's turn. */
+	S.PointerX = Pointer::X, S.PointerY = Pointer::Y;
+	S.ShowPointer = Pointer::Show && !(this->Game->AIEnabled() && S.CurrentPlayer == StackMem::Players::Player2);
+	S.MarkTag = this->MarkTag, S.MarkFrame = this->MarkFrame, S.MarkID = this->MarkID;
 }
 
 
-/* Least amount of tries Play Draw. */
-void GameHelper::DrawTryPlay(void) const {
+/*
+	Least amount of tries Play Draw.
+
+	const Snapshot &S: The snapshot to draw.
+*/
+void GameHelper::DrawTryPlay(const GameHelper::Snapshot &S) const {
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("GAME_SCREEN_TITLE"), 395);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_TITLE), 395);
 
 	/* Draw Player 1. */
 	if (this->Params.Characters[0] < Utils::GetCharSheetSize()) {
 		Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30, 30);
 		Gui::DrawSprite(GFX::Sprites, sprites_outline_idx, 28, 28);
 		Gui::Draw_Rect(37, 159, 106, 20, BAR_BLUE);
-		Gui::DrawString(40, 162, 0.45f, TEXT_WHITE, this->Params.Names[0], 100);
+		GFX::DrawString(40, 162, 0.45f, TEXT_WHITE, this->Params.Names[0], 100);
 	}
 
-	Gui::DrawString(200, 100, 0.5f, TEXT_WHITE, Lang::Get("GAME_SCREEN_TRIES") + std::to_string(this->Params.Guesses[0]), 200);
-	Gui::DrawString(200, 120, 0.5f, TEXT_WHITE, Lang::Get("GAME_SCREEN_MISSES") + std::to_string(this->Params.Guesses[1]), 200);
+	GFX::DrawString(200, 100, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_TRIES) + std::to_string(S.Guesses[0]), 200);
+	GFX::DrawString(200, 120, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_MISSES) + std::to_string(S.Guesses[1]), 200);
 
-	if (this->Game->GetPairs() > 10) { // Only 11+ Pairs have pages.
-		Gui::DrawString(180, 150, 0.5f, TEXT_WHITE, Lang::Get("GAME_SCREEN_CURRENT_PAGE") + std::to_string(this->Page + 1) + " / " + std::to_string((this->Game->GetPairs() + 9) * 2 / 20), 200);
+	if (this->Layout.Pages(S.Cards.size()) > 1) { // Only show the page, if there is more than one.
+		GFX::DrawString(180, 150, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_CURRENT_PAGE) + std::to_string(S.Page + 1) + " / " + std::to_string(this->Layout.Pages(S.Cards.size())), 200);
 	}
 
 	if (!this->Params.CardDelayUsed || this->Params.CardDelay == 0) { // The checks only exist on non delay mode.
-		if (this->Game->GetState() == StackMem::TurnState::DoCheck) {
-			Gui::DrawStringCentered(0, 225, 0.4f, TEXT_WHITE, Lang::Get("GAME_SCREEN_ANY_KEY"), 390);
+		if (S.State == StackMem::TurnState::DoCheck) {
+			GFX::DrawStringCentered(0, 225, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_ANY_KEY), 390);
 		}
 	}
 }
 
 
-/* Normal Play Draw. */
-void GameHelper::DrawNormalPlay(void) const {
+/*
+	Normal Play Draw.
+
+	const Snapshot &S: The snapshot to draw.
+*/
+void GameHelper::DrawNormalPlay(const GameHelper::Snapshot &S) const {
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("GAME_SCREEN_TITLE"), 395);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_TITLE), 395);
 
 	/* Draw Player 1. */
 	if (this->Params.Characters[0] < Utils::GetCharSheetSize()) {
 		Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30, 30);
 		Gui::Draw_Rect(37, 159, 106, 20, BAR_BLUE);
-		Gui::DrawString(40, 162, 0.45f, TEXT_WHITE, this->Params.Names[0], 100);
+		GFX::DrawString(40, 162, 0.45f, TEXT_WHITE, this->Params.Names[0], 100);
 
-		Gui::DrawString(37, 190, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(this->Game->GetPlayerPairs(StackMem::Players::Player1)), 100);
+		GFX::DrawString(37, 190, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(S.PlayerPairs[0]), 100);
 	}
 
 	/* Draw Player 2. */
 	if (this->Params.Characters[1] < Utils::GetCharSheetSize()) {
 		Gui::DrawSprite(GFX::Characters, this->Params.Characters[1], 250, 30);
 		Gui::Draw_Rect(257, 159, 106, 20, BAR_BLUE);
-		Gui::DrawString(260, 162, 0.45f, TEXT_WHITE, this->Params.Names[1], 100);
+		GFX::DrawString(260, 162, 0.45f, TEXT_WHITE, this->Params.Names[1], 100);
 
-		Gui::DrawString(257, 190, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(this->Game->GetPlayerPairs(StackMem::Players::Player2)), 100);
+		GFX::DrawString(257, 190, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(S.PlayerPairs[1]), 100);
 	}
 
 	/* Draw Current Player. */
-	if (this->Game->GetCurrentPlayer() == StackMem::Players::Player1) {
+	if (S.CurrentPlayer == StackMem::Players::Player1) {
 		Gui::DrawSprite(GFX::Sprites, sprites_outline_idx, 28, 28);
-		Gui::DrawStringCentered(0, 205, 0.4f, TEXT_WHITE, Lang::Get("GAME_SCREEN_CURRENT_PLAYER") + this->Params.Names[0], 390);
+		GFX::DrawStringCentered(0, 205, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_CURRENT_PLAYER) + this->Params.Names[0], 390);
 
 	} else {
 		Gui::DrawSprite(GFX::Sprites, sprites_outline_idx, 248, 28);
-		Gui::DrawStringCentered(0, 205, 0.4f, TEXT_WHITE, Lang::Get("GAME_SCREEN_CURRENT_PLAYER") + this->Params.Names[1], 390);
+		GFX::DrawStringCentered(0, 205, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_CURRENT_PLAYER) + this->Params.Names[1], 390);
 	}
 
-	if (this->Game->GetPairs() > 10) { // Only 11+ Pairs have pages.
-		Gui::DrawStringCentered(0, 215, 0.4f, TEXT_WHITE, Lang::Get("GAME_SCREEN_CURRENT_PAGE") + std::to_string(this->Page + 1) + " / " + std::to_string((this->Game->GetPairs() + 9) * 2 / 20), 390);
+	if (this->Layout.Pages(S.Cards.size()) > 1) { // Only show the page, if there is more than one.
+		GFX::DrawStringCentered(0, 215, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_CURRENT_PAGE) + std::to_string(S.Page + 1) + " / " + std::to_string(this->Layout.Pages(S.Cards.size())), 390);
 	}
 
 	if (!this->Params.CardDelayUsed || this->Params.CardDelay == 0) { // The checks only exist on non delay mode.
 		/* Only display if current State is the check state.. OR the AI's turn. */
-		if ((this->Game->GetState() == StackMem::TurnState::DoCheck) || (this->Game->GetCurrentPlayer() == StackMem::Players::Player2 && this->Game->AIEnabled())) {
-			Gui::DrawStringCentered(0, 225, 0.4f, TEXT_WHITE, Lang::Get("GAME_SCREEN_ANY_KEY"), 390);
+		if ((S.State == StackMem::TurnState::DoCheck) || (S.CurrentPlayer == StackMem::Players::Player2 && this->Params.AIUsed)) {
+			GFX::DrawStringCentered(0, 225, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SCREEN_ANY_KEY), 390);
+		}
+	}
+}
+
+
+/*
+	Draws the top screen.
+
+	const Snapshot &S: The snapshot to draw.
+*/
+void GameHelper::DrawTop(const GameHelper::Snapshot &S) const {
+	if (S.CurPhase != Phase::Play) { // Start and End Animation only show the characters.
+		GFX::DrawTop();
+		const int Offset = S.Fade;
+
+		/* Draw First character. It's included in both play modes. */
+		if (this->Params.Characters[0] < Utils::GetCharSheetSize()) {
+			Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30 - Offset, 30);
 		}
+
+		/* Draw Second character. It's only included in Versus Mode.. */
+		if (this->Params.GameMode == GameSettings::GameModes::Versus) {
+			if (this->Params.Characters[1] < Utils::GetCharSheetSize()) {
+				Gui::DrawSprite(GFX::Characters, this->Params.Characters[1], 250 + Offset, 30);
+			}
+		}
+
+		if (this->DoFadeRect(S)) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, Offset));
+		return;
 	}
+
+	this->TopLayer.Draw(Top, this->TopKey(S), [this, &S]() {
+		if (this->Params.GameMode == GameSettings::GameModes::Solo) this->DrawTryPlay(S);
+		else this->DrawNormalPlay(S);
+	});
 }
 
 
-void GameHelper::DrawTop(void) const {
-	if (this->Params.GameMode == GameSettings::GameModes::Solo) this->DrawTryPlay();
-	else this->DrawNormalPlay();
+/*
+	All values, which the top screen shows while playing.
+
+	const Snapshot &S: The snapshot to draw.
+*/
+CachedLayer::Key GameHelper::TopKey(const GameHelper::Snapshot &S) const {
+	return {
+		S.Page,
+		S.PlayerPairs[0],
+		S.PlayerPairs[1],
+		(size_t)S.CurrentPlayer,
+		(size_t)S.State,
+		S.Guesses[0],
+		S.Guesses[1],
+		S.Round // A new round is always drawn again.
+	};
 }
 
 
 /*
-	Draws the Gamefield with the cards.
+	If the fade rectangle of the Start and End Animation should be drawn.
+
+	const Snapshot &S: The snapshot to draw.
 */
-void GameHelper::DrawField(const bool ShowPointer) const {
-	GFX::DrawBottom(); // Focus the drawing on the bottom.
+bool GameHelper::DoFadeRect(const GameHelper::Snapshot &S) const {
+	if ((int)S.Fade <= 0) return false;
+	return (S.CurPhase == Phase::Outro || _3DZwei::CFG->DoFade());
+}
+
+
+/*
+	Builds the scene node of a page of the Gamefield with the side page buttons.
+
+	const Snapshot &S: The snapshot to draw.
+	const Scene::NodeID Node: The node to build into.
+	const size_t Pg: The page to build.
+*/
+void GameHelper::BuildPage(const GameHelper::Snapshot &S, const Scene::NodeID Node, const size_t Pg) const {
+	this->Field.Clear(Node);
 
 	/*
-		Draws the side pages buttons, if you can go backward / forward.
-		This is only necessary, if you have more than 10 Pairs though, because 10 Pairs fit exactly on screen.
+		Adds the side pages buttons, if you can go backward / forward.
+		This is only necessary, if the cards don't fit on one page.
 	*/
-	if (this->Game->GetPairs() > 10) {
-		if (this->Page > 0) { // Because we can go back.
-			Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0, 0); // Draw the small top corner.
-			Gui::Draw_Rect(0, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-			Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0, 220, 1.0f, -1.0f); // Draw the small bottom corner.
-			Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0, 110); // Now the arrow!
+	if (this->Layout.Pages(S.Cards.size()) > 1) {
+		if (Pg > 0) { // Because we can go back.
+			this->Field.Sprite(Node, 0, GFX::Sprites, sprites_small_corner_idx, 0, 0); // The small top corner.
+			this->Field.Rect(Node, 0, 0, 20, 20, 200, BAR_BLUE); // The Middle corner bar.
+			this->Field.Sprite(Node, 0, GFX::Sprites, sprites_small_corner_idx, 0, 220, 1.0f, -1.0f); // The small bottom corner.
+			this->Field.Sprite(Node, 1, GFX::Sprites, sprites_arrow_idx, 0, 110); // Now the arrow on top of the bar!
 		}
 
-		if (this->CanGoForward(this->Page)) { // Because we can go forward.
-			Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300, 0, -1.0f, 1.0f); // Draw the small top corner.
-			Gui::Draw_Rect(300, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-			Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300, 220, -1.0f, -1.0f); // Draw the small bottom corner.
-			Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300, 110, -1.0f, 1.0f); // Now the arrow!
+		if (Pg + 1 < this->Layout.Pages(S.Cards.size())) { // Because we can go forward.
+			this->Field.Sprite(Node, 0, GFX::Sprites, sprites_small_corner_idx, 300, 0, -1.0f, 1.0f); // The small top corner.
+			this->Field.Rect(Node, 0, 300, 20, 20, 200, BAR_BLUE); // The Middle corner bar.
+			this->Field.Sprite(Node, 0, GFX::Sprites, sprites_small_corner_idx, 300, 220, -1.0f, -1.0f); // The small bottom corner.
+			this->Field.Sprite(Node, 1, GFX::Sprites, sprites_arrow_idx, 300, 110, -1.0f, 1.0f); // Now the arrow on top of the bar!
 		}
 	}
 
-	/* Draw the cards. */
-	for (size_t Idx = (this->Page * 20), Idx2 = 0; Idx < (this->Page * 20) + 20 && Idx < (this->Game->GetPairs() * 2); Idx++, Idx2++) {
-		if (!this->Game->IsCardCollected(Idx)) { // Ensure the card is NOT collected.
+	/* Add the cards. */
+	const size_t PerPage = this->Layout.PerPage();
+	const float CardScale = this->Layout.Scale();
 
-			/* This is a turn card, hence we draw it with scale. */
-			if (this->Game->GetTurnCard(0) != -1 && this->Game->GetTurnCard(0) == (int)Idx) {
-				if (this->CardClicked[0]) { // Animation is done, soo draw front cover.
-					GFX::DrawCard(this->Game->GetCardType(this->Game->GetTurnCard(0)), this->CPos[Idx2].X + (1.0f - this->ClickedScale[0]) * 55 / 2, this->CPos[Idx2].Y, this->ClickedScale[0], 1.0f);
+	for (size_t Idx = (Pg * PerPage), Idx2 = 0; Idx < (Pg * PerPage) + PerPage && Idx < S.Cards.size(); Idx++, Idx2++) {
+		if (S.Cards[Idx].Collected) continue; // Ensure the card is NOT collected.
+		const BoardLayout::Rect Card = this->Layout.Card(Idx2);
+		const size_t Front = ((size_t)S.Cards[Idx].Type < Utils::Cards.size() ? Utils::Cards[S.Cards[Idx].Type] : Utils::GetCardSheetSize());
+		bool TurnCard = false;
 
-				} else { // Draw Back cover.
-					Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X + (1.0f - this->ClickedScale[0]) * 55 / 2, this->CPos[Idx2].Y, this->ClickedScale[0], 1.0f);
+		/* This is a turn card, hence it gets drawn with scale. */
+		for (uint8_t Turn = 0; Turn < 2; Turn++) {
+			if (S.TurnCards[Turn] != (int)Idx) continue;
+			const float Scale = S.ClickedScale[Turn];
+			TurnCard = true;
+
+			/* Front cover, or back cover. */
+			this->Field.Sprite(Node, 1, GFX::Cards, (S.CardClicked[Turn] ? Front : Utils::GetCardSheetSize()), Card.X + (1.0f - Scale) * Card.W / 2, Card.Y, Scale * CardScale, CardScale);
+		}
+
+		if (!TurnCard) { // Back cover, if hidden.
+			this->Field.Sprite(Node, 1, GFX::Cards, (S.Cards[Idx].Shown ? Front : Utils::GetCardSheetSize()), Card.X, Card.Y, CardScale, CardScale);
+		}
+	}
+}
+
+
+/*
+	Draws the cards of the Start Animation.
+
+	const Snapshot &S: The snapshot to draw.
+*/
+void GameHelper::DrawIntro(const GameHelper::Snapshot &S) const {
+	const float CardScale = this->Layout.Scale();
+
+	switch(S.IntroType) {
+		case 1: // Falling.
+			for (size_t Idx = 0; Idx < S.WaveOffset.size(); Idx++) { // Loop through the amount of waves.
+				const int Offset = S.WaveOffset[Idx];
+
+				for (const uint8_t Slot : this->Layout.Wave(Idx, this->IntroCards(S.Cards.size()))) { // Loop through their contents.
+					const BoardLayout::Rect Card = this->Layout.Card(Slot);
+					this->IntroBatch.AddBack(Card.X - Offset, Card.Y - Offset, CardScale, CardScale);
 				}
 			}
 
-			/* This is a turn card, hence we draw it with scale. */
-			if (this->Game->GetTurnCard(1) != -1 && this->Game->GetTurnCard(1) == (int)Idx) {
-				if (this->CardClicked[1]) { // Animation is done, soo draw front cover.
-					GFX::DrawCard(this->Game->GetCardType(this->Game->GetTurnCard(1)), this->CPos[Idx2].X + (1.0f - this->ClickedScale[1]) * 55 / 2, this->CPos[Idx2].Y, this->ClickedScale[1], 1.0f);
+			this->IntroBatch.Draw();
+			break;
 
-				} else { // Draw Back cover.
-					Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X + (1.0f - this->ClickedScale[1]) * 55 / 2, this->CPos[Idx2].Y, this->ClickedScale[1], 1.0f);
-				}
+		case 2: // Growing.
+			for (size_t Idx = 0; Idx < S.GrowScale.size(); Idx++) {
+				if (S.GrowScale[Idx] <= 0.0f) break; // The next cards didn't start yet.
+				const BoardLayout::Rect Card = this->Layout.Card(Idx);
+				this->IntroBatch.AddBack(Card.X, Card.Y, S.GrowScale[Idx] * CardScale, S.GrowScale[Idx] * CardScale);
 			}
 
-			if (this->Game->GetTurnCard(0) != (int)Idx && this->Game->GetTurnCard(1) != (int)Idx) {
-				if (this->Game->IsCardShown(Idx)) GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X, this->CPos[Idx2].Y);
-				else Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X, this->CPos[Idx2].Y); // Back cover because hidden.
+			this->IntroBatch.Draw();
+
+			if (this->DoFadeRect(S)) { // Already grown cards get faded in as well.
+				for (size_t Idx = 0; Idx < S.GrowScale.size() && S.GrowScale[Idx] > 0.0f; Idx++) {
+					if (S.GrowScale[Idx] < 1.0f) continue;
+					const BoardLayout::Rect Card = this->Layout.Card(Idx);
+					Gui::Draw_Rect(Card.X, Card.Y, Card.W, Card.H, C2D_Color32(0, 0, 0, (int)S.Fade));
+				}
 			}
-		}
+			break;
+	}
+}
+
+
+/*
+	Draws the Gamefield with the cards.
+
+	const Snapshot &S: The snapshot to draw.
+*/
+void GameHelper::DrawField(const GameHelper::Snapshot &S) const {
+	GFX::DrawBottom(); // Focus the drawing on the bottom.
+
+	if (S.CurPhase != Phase::Play) {
+		if (this->DoFadeRect(S)) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, (int)S.Fade));
+		if (S.CurPhase == Phase::Intro) this->DrawIntro(S);
+		else S.Effects.Draw(); // The last pair bursts, while the End Animation starts.
+		return;
+	}
+
+	if (S.FieldVersion != this->BuiltVersion) {
+		this->BuildPage(S, this->PageNodes[0], S.Page);
+		if (S.Swiping) this->BuildPage(S, this->PageNodes[1], S.SwipeTarget);
+		this->BuiltVersion = S.FieldVersion;
 	}
 
-	if (this->Game->AIEnabled()) {
-		if (this->Game->GetCurrentPlayer() != StackMem::Players::Player2 && ShowPointer) Pointer::Draw();
+	/* A swipe only moves both pages: The current page swipes out and the target page swipes in. */
+	if (S.Swiping) {
+		const int Offset = S.SwipePos, Dir = (S.SwipeTarget > S.Page ? -1 : 1); // -> to <-, or <- to ->.
+
+		this->Field.SetPos(this->PageNodes[0], Dir * Offset, 0);
+		this->Field.SetPos(this->PageNodes[1], Dir * (Offset - 320), 0);
 
 	} else {
-		Pointer::Draw();
+		this->Field.SetPos(this->PageNodes[0], 0, 0);
 	}
+
+	this->Field.SetVisible(this->PageNodes[1], S.Swiping);
+	this->Field.Draw();
+	S.Effects.Draw();
+
+	if (S.ShowPointer) Pointer::Draw(S.PointerX, S.PointerY);
 }
 
 
@@ -243,7 +438,11 @@ void GameHelper::DrawField(const bool ShowPointer) const {
 
 	const size_t CurPage: The current page which should be checked, if you can go forward.
 */
-bool GameHelper::CanGoForward(const size_t CurPage) const { return ((CurPage * 20) + 20 < (this->Game->GetPairs() * 2)); }
+bool GameHelper::CanGoForward(const size_t CurPage) const { return ((CurPage + 1) * this->Layout.PerPage() < (this->Game->GetPairs() * 2)); }
+
+
+/* The page the field is on, or swiping to. */
+size_t GameHelper::TargetPage() const { return (this->Swiping ? this->SwipeTarget : this->Page); }
 
 
 /*
@@ -251,6 +450,8 @@ bool GameHelper::CanGoForward(const size_t CurPage) const { return ((CurPage * 2
 	Returns true, if it was able to go to the previous page.
 */
 bool GameHelper::PrevPage() {
+	this->Anims.CancelGroup((uint8_t)AnimGroup::Page, true); // Finish the previous swipe first.
+
 	if (this->Page > 0) {
 		this->PageAnimation(false);
 		return true;
@@ -265,6 +466,8 @@ bool GameHelper::PrevPage() {
 	Returns true, if it was able to go to the next page.
 */
 bool GameHelper::NextPage() {
+	this->Anims.CancelGroup((uint8_t)AnimGroup::Page, true); // Finish the previous swipe first.
+
 	if (this->CanGoForward(this->Page)) {
 		this->PageAnimation(true);
 		return true;
@@ -275,395 +478,229 @@ bool GameHelper::NextPage() {
 
 
 /*
-	This is used for the Callbacks.
+	Moves the pages with the finger. The page next to the current one in the drag direction follows from the side.
 
-	const uint8_t Idx: The index which got clicked.
+	const float DX: The horizontal distance of the drag.
 */
-void GameHelper::CheckCard(const uint8_t Idx) {
-	if (((this->Page * 20) + Idx < this->Game->GetPairs() * 2)) {
-		if (!this->Game->IsCardShown((this->Page * 20) + Idx)) this->PickAnimation((this->Page * 20) + Idx);
+void GameHelper::DragPage(const float DX) {
+	if (!this->Dragging) this->Anims.CancelGroup((uint8_t)AnimGroup::Page, true); // Finish the previous swipe first.
+	this->Dragging = true;
+	GFX::Invalidate();
+
+	const bool Forward = (DX < 0.0f); // Dragging to the left shows the next page.
+	if (Forward ? !this->CanGoForward(this->Page) : this->Page == 0) { // There's no page on that side.
+		this->Swiping = false, this->SwipePos = 0.0f;
+		return;
 	}
-}
-
-
-/* Get the amount of indexes for a specified Pairs amount. */
-uint8_t GameHelper::GetIndexCount() const {
-	switch(this->Game->GetPairs()) {
-		case 0: return 1;
-		case 1: return 2;
-		case 2: return 4;
 
-		case 3:
-		case 4: return 5;
-
-		case 5:
-		case 6:
-		case 7: return 6;
-
-		case 8:
-		case 9: return 9;
+	const size_t Target = (Forward ? (this->Page + 1) : (this->Page - 1));
+	if (!this->Swiping || this->SwipeTarget != Target) {
+		this->Swiping = true, this->SwipeTarget = Target;
+		this->FieldVersion++;
 	}
 
-	if (this->Game->GetPairs() >= 10) return 8;
-	else return 0;
+	this->SwipePos = std::min(std::fabs(DX), 320.0f);
 }
 
 
 /*
-	Get the indexes for a specific "round".
+	Lets the pages go after a drag.
+	A swipe or flick finishes the switch to the target page from where the finger left it, otherwise the pages move back.
 
-	const uint8_t Round: The "round".
+	const bool Switch: If it should switch to the target page.
 */
-std::vector<uint8_t> GameHelper::GetAnimationIdx(const uint8_t Round) const {
-	if (this->Game->GetPairs() >= 10) {
-		switch(Round) { // 10+.
-			case 0: return { 19 };
-			case 1: return { 18, 14 };
-			case 2: return { 17, 13, 9 };
-			case 3: return { 16, 12, 8, 4 };
-			case 4: return { 15, 11, 7, 3 };
-			case 5: return { 10, 6, 2 };
-			case 6: return { 5, 1 };
-			case 7: return { 0 };
-		}
+void GameHelper::DropPage(const bool Switch) {
+	if (!this->Dragging) return;
+	this->Dragging = false;
+	if (!this->Swiping) return;
 
-	} else { // 9 - 0.
-		switch(this->Game->GetPairs()) {
-			case 9:
-				switch(Round) {
-					case 0: return { 14 };
-					case 1: return { 17, 13, 9 };
-					case 2: return { 16, 12, 8, 4 };
-					case 3: return { 15, 11, 7, 3 };
-					case 4: return { 10, 6, 2 };
-					case 5: return { 5, 1 };
-					case 6: return { 0 };
-				}
-				break;
+	const uint32_t Frames = ((_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->PageSwitch()) ? 12 : 0);
 
-			case 8:
-				switch(Round) {
-					case 0: return { 14 };
-					case 1: return { 13, 9 };
-					case 2: return { 12, 8, 4 };
-					case 3: return { 15, 11, 7, 3 };
-					case 4: return { 10, 6, 2 };
-					case 5: return { 5, 1 };
-					case 6: return { 0 };
-				}
-				break;
-
-			case 7:
-				switch(Round) {
-					case 0: return { 13, 9 };
-					case 1: return { 12, 8, 4 };
-					case 2: return { 11, 7, 3 };
-					case 3: return { 10, 6, 2 };
-					case 4: return { 5, 1 };
-					case 5: return { 0 };
-				}
-				break;
-
-			case 6:
-				switch(Round) {
-					case 0: return { 9 };
-					case 1: return { 8, 4 };
-					case 2: return { 11, 7, 3 };
-					case 3: return { 10, 6, 2 };
-					case 4: return { 5, 1 };
-					case 5: return { 0 };
-				}
-				break;
+	if (Switch) {
+		this->Mark("Page");
 
-			case 5:
-				switch(Round) {
-					case 0: return { 9 };
-					case 1: return { 8, 4 };
-					case 2: return { 7, 3 };
-					case 3: return { 6, 2 };
-					case 4: return { 5, 1 };
-					case 5: return { 0 };
-				}
-				break;
+		this->SwipePage(this->SwipeTarget, Frames, [this]() {
+			const size_t Cards = this->Game->GetPairs() * 2, PerPage = this->Layout.PerPage();
+			if ((this->Page * PerPage) + this->Selection + 1 > Cards) this->SelectCard((Cards - 1) % PerPage); // Ensureness.
+		});
 
-			case 4:
-				switch(Round) {
-					case 0: return { 4 };
-					case 1: return { 7, 3 };
-					case 2: return { 6, 2 };
-					case 3: return { 5, 1 };
-					case 4: return { 0 };
-				}
-				break;
+		return;
+	}
 
-			case 3:
-				switch(Round) {
-					case 0: return { 4 };
-					case 1: return { 3 };
-					case 2: return { 2 };
-					case 3: return { 5, 1 };
-					case 4: return { 0 };
-				}
-				break;
+	this->Anims.Add(this->SwipePos, this->SwipePos, 0.0f, Frames, Animator::Ease::OutCubic, [this]() {
+		this->SwipePos = 0.0f, this->Swiping = false; // Stay on the page.
+	}, (uint8_t)AnimGroup::Page);
+}
 
-			case 2:
-				switch(Round) {
-					case 0: return { 3 };
-					case 1: return { 2 };
-					case 2: return { 1 };
-					case 3: return { 0 };
-				}
-				break;
 
-			case 1:
-				switch(Round) {
-					case 0: return { 1 };
-					case 1: return { 0 };
-				}
-				break;
+/*
+	Selects a card of the page and moves the pointer on it.
 
-			case 0: return { 0 };
-		}
-	}
+	const size_t Slot: The index of the card on the page.
+*/
+void GameHelper::SelectCard(const size_t Slot) {
+	const BoardLayout::Rect Card = this->Layout.Card(Slot);
 
-	return { 0 };
+	this->Selection = Slot;
+	Pointer::SetPos(Card.X + Card.W / 3, Card.Y + Card.H / 3);
 }
 
 
 /*
-	Game Animation 1: Let the cards fall down in group from the top left.
+	Handles a click or touch on the Gamefield.
+	Returns true, if a card or a page button got pressed.
 
-	const size_t Pairs: The Pairs amount.
-	const GameSettings::GameParams &Params: The Game Parameters.
+	const float X: The X-Position of the click.
+	const float Y: The Y-Position of the click.
 */
-void GameHelper::StartGameAnimationFalling() {
-	if (!_3DZwei::CFG->DoAnimation()) return; // No animation.
+bool GameHelper::Press(const float X, const float Y) {
+	const int Slot = this->Layout.Slot(X, Y);
 
-	/* Full state / Top Swipe related. */
-	bool Done = false, DoSwipe = true;
-	int Delay = 255, Dones = 0;
-	float Swipe = 0.0f;
-
-	/* Card Animation related. */
-	std::vector<bool> Animations;
-	std::vector<int> AnimPos;
-	std::vector<float> Anim2;
-	std::vector<std::vector<uint8_t>> AnimationIdxs;
-
-	for (size_t Idx = 0; Idx < this->GetIndexCount(); Idx++) { // Init the animations.
-		Animations.push_back(true); // Animation State.
-		AnimationIdxs.push_back(GetAnimationIdx(Idx)); // Indexes.
-		AnimPos.push_back(320); // Animation Position.
-		Anim2.push_back(0.0f);
+	if (Slot >= 0) {
+		this->CheckCard(Slot);
+		return true;
 	}
 
-	while(aptMainLoop() && !Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+	const int Button = this->PageButtonsIndex.Find(X, Y);
+	if (Button < 0) return false;
 
-		GFX::DrawTop();
-		/* Draw First character. It's included in both play modes. */
-		if (this->Params.Characters[0] < Utils::GetCharSheetSize()) {
-			Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30 - Delay, 30);
-		}
+	this->PageButtons[Button].Func();
+	return true;
+}
 
-		/* Draw Second character. It's only included in Versus Mode.. */
-		if (this->Params.GameMode == GameSettings::GameModes::Versus) {
-			if (this->Params.Characters[1] < Utils::GetCharSheetSize()) {
-				Gui::DrawSprite(GFX::Characters, this->Params.Characters[1], 250 + Delay, 30);
-			}
-		}
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, Delay));
-		}
+/*
+	Marks a visible change of the press, which is handled right now, for the latency measurement.
+	Only the first change of a press counts, and a change without a press, like of the AI's delay, doesn't.
 
-		GFX::DrawBottom();
+	const char *Tag: What became visible, e.g. "Flip" or "Page". Must be a string literal.
+*/
+void GameHelper::Mark(const char *Tag) {
+	if (this->Cause == 0) return;
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (Delay > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, Delay));
-		}
+	this->MarkTag = Tag, this->MarkFrame = this->Cause, this->MarkID++;
+	this->Cause = 0;
+	GFX::Invalidate(); // The snapshot has to be published.
+}
 
-		/* Display Card Animation. */
-		for (size_t Idx = 0; Idx < AnimationIdxs.size(); Idx++) { // Loop through the amount of animations.
-			for (size_t Idx2 = 0; Idx2 < AnimationIdxs[Idx].size(); Idx2++) { // Loop through their contents.
-				Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[AnimationIdxs[Idx][Idx2]].X - AnimPos[Idx], this->CPos[AnimationIdxs[Idx][Idx2]].Y - AnimPos[Idx]);
-			}
-		}
 
-		C3D_FrameEnd(0);
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) Done = true; // You can always skip this by pressing any key, if it's too long for you.
+/*
+	Picks a card of the current page.
 
-		for (size_t Idx = 0; Idx < AnimationIdxs.size(); Idx++) {
-			if (!Animations[Idx]) continue; // Animation for this already over, continue with the next one in the loop.
+	const size_t Slot: The index of the card on the page.
+*/
+void GameHelper::CheckCard(const size_t Slot) {
+	this->Anims.CancelGroup((uint8_t)AnimGroup::Page, true); // The card has to be on the final page.
+	const size_t Card = (this->Page * this->Layout.PerPage()) + Slot;
 
-			if (Idx == 0) { // 0: Do NOT look back at previous position.
-				Anim2[0] = std::lerp(Anim2[0], 320.0f, 0.1f);
-				AnimPos[0] = 320 - Anim2[0];
+	if (Card < this->Game->GetPairs() * 2) {
+		if (!this->Game->IsCardShown(Card)) this->PickAnimation(Card);
+	}
+}
 
-				if (Anim2[0] >= 319.95f) {
-					AnimPos[0] = 0;
-					Anim2[0] = 0.0f;
-					Animations[0] = false;
-				}
 
-			} else { // Look back at previous position.
-				if (AnimPos[Idx - 1] <= 100) { // Wait some bit for next cards and check previous cards position.
-					Anim2[Idx] = std::lerp(Anim2[Idx], 320.0f, 0.1f);
-					AnimPos[Idx] = 320 - Anim2[Idx];
+/*
+	The amount of cards on the first page, which are part of the Start Animation.
 
-					if (Anim2[Idx] >= 319.95f) {
-						AnimPos[Idx] = 0;
-						Anim2[Idx] = 0.0f;
-						Animations[Idx] = false;
-					}
-				}
-			}
-		}
+	const size_t Cards: The amount of cards of the game.
+*/
+size_t GameHelper::IntroCards(const size_t Cards) const { return std::min(this->Layout.PerPage(), Cards); }
 
-		Dones = 0; // Reset otherwise it'd be way over the max.
-		for (size_t Idx = 0; Idx < AnimationIdxs.size(); Idx++) {
-			if (!Animations[Idx]) Dones++; // If animation is done, increase our Dones.
-		}
 
-		if (DoSwipe) {
-			if (Swipe < 255) {
-				Swipe = std::lerp(Swipe, 255.0f, 0.1f);
-				Delay = 255 - Swipe;
+/* Lets both cards of the collected pair burst into fragments, if they're on the current page. */
+void GameHelper::PairBurst() {
+	if (!_3DZwei::CFG->DoAnimation()) return;
+	static const uint32_t Colors[] = { TEXT_WHITE, C2D_Color32(255, 210, 60, 255), C2D_Color32(140, 180, 255, 255) }; // Bright on BG_BLUE.
 
-				if (Swipe >= 254.95f) {
-					Delay = 0;
-					Swipe = 0;
-					DoSwipe = false;
-				}
-			}
-		}
+	for (uint8_t Turn = 0; Turn < 2; Turn++) {
+		const int Idx = this->Game->GetTurnCard(Turn);
+		if (Idx < 0 || (size_t)Idx / this->Layout.PerPage() != this->Page) continue;
 
-		if ((Dones == (int)AnimationIdxs.size()) && (!DoSwipe)) Done = true; // Set to done when the move / fade delay is over.. and the cards too.
+		const BoardLayout::Rect Card = this->Layout.Card(Idx % this->Layout.PerPage());
+		this->Effects.Burst(Card.X + Card.W / 2, Card.Y + Card.H / 2, PAIR_PARTICLES, 3.0f, Colors, 3);
 	}
 }
 
 
 /*
-	Game Animation 2: Grow up all cards.
+	Game Animation 1: Let the cards fall down in group from the top left.
 
-	const size_t Pairs: The Pairs amount.
-	const GameSettings::GameParams &Params: The Game Parameters.
+	const std::function<void()> &Done: Called, once a tween of the animation finished.
 */
-void GameHelper::StartGameAnimationGrowing() {
-	if (!_3DZwei::CFG->DoAnimation()) return; // No animation.
-
-	bool Done = false, DoSwipe = true;
-	int Delay = 255, CCard = 0, ToInit = 0;
-	float CardScale = 0.1f, Swipe = 0.0f, Cubic = 0.0f;
-
-	if (this->Game->GetPairs() >= 10) ToInit = 20; // 10+ -> 20.
-	else ToInit = this->Game->GetPairs() * 2; // Else Pairs * 2.
+void GameHelper::StartGameAnimationFalling(const std::function<void()> &Done) {
+	this->WaveOffset.assign(this->Layout.WaveCount(this->IntroCards(this->Game->GetPairs() * 2)), 320.0f);
 
-	while(aptMainLoop() && !Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-
-		GFX::DrawTop();
-		/* Draw First character. It's included in both play modes. */
-		if (this->Params.Characters[0] < Utils::GetCharSheetSize()) {
-			Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30 - Delay, 30);
-		}
+	/* Every wave starts a bit after the previous one. */
+	for (size_t Idx = 0; Idx < this->WaveOffset.size(); Idx++) {
+		this->Anims.Add(this->WaveOffset[Idx], 320.0f, 0.0f, 40, Animator::Ease::OutCubic, Done, (uint8_t)AnimGroup::Intro, Idx * 11);
+	}
+}
 
-		/* Draw Second character. It's only included in Versus Mode.. */
-		if (this->Params.GameMode == GameSettings::GameModes::Versus) {
-			if (this->Params.Characters[1] < Utils::GetCharSheetSize()) {
-				Gui::DrawSprite(GFX::Characters, this->Params.Characters[1], 250 + Delay, 30);
-			}
-		}
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, Delay));
-		}
+/*
+	Game Animation 2: Grow up all cards.
 
-		GFX::DrawBottom();
+	const std::function<void()> &Done: Called, once a tween of the animation finished.
+*/
+void GameHelper::StartGameAnimationGrowing(const std::function<void()> &Done) {
+	const size_t ToInit = this->IntroCards(this->Game->GetPairs() * 2);
+	this->GrowScale.assign(ToInit, 0.0f);
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (Delay > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, Delay));
-		}
+	/* One card after another. */
+	for (size_t Idx = 0; Idx < ToInit; Idx++) {
+		this->Anims.Add(this->GrowScale[Idx], 0.0f, 1.0f, 9, Animator::Ease::OutCubic, Done, (uint8_t)AnimGroup::Intro, Idx * 9);
+	}
+}
 
-		/* Draw already growed cards. */
-		for (int Idx = 0; Idx < CCard; Idx++) {
-			Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx].X, this->CPos[Idx].Y);
-			if (Delay > 0) Gui::Draw_Rect(this->CPos[Idx].X, this->CPos[Idx].Y, 55, 55, C2D_Color32(0, 0, 0, Delay));
-		}
 
-		if (CCard < ToInit) Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[CCard].X, this->CPos[CCard].Y, CardScale, CardScale);
-		C3D_FrameEnd(0);
+/* The Start Animation of the game. */
+void GameHelper::StartGameAnimation() {
+	this->Anims.Clear(); // Nothing from the previous round should be left.
+	this->CurPhase = Phase::Play, this->IntroType = 0;
+	this->Swiping = false, this->SwipePos = 0.0f, this->Fade = 0.0f;
 
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) Done = true; // You can always skip this by pressing any key, if it's too long for you.
+	if (!_3DZwei::CFG->DoAnimation()) return; // No animation.
 
-		if (CCard < ToInit) {
-			if (Cubic < 0.95f) {
-				Cubic = std::lerp(Cubic, 1.0f, 0.3f);
-				CardScale = Cubic;
+	this->IntroType = _3DZwei::CFG->GameAnimation();
+	if (this->IntroType == 0) this->IntroType = rand() % START_ANIMATION_AMOUNT + 1; // Random: 1 - 2 currently.
 
-				if (Cubic >= 0.95f) {
-					CardScale = 0.0f, Cubic = 0.0f;
-					CCard++;
-				}
-			}
-		}
+	/* The game starts, once the last tween of the intro is done. */
+	const std::function<void()> Done = [this]() {
+		if (!this->Anims.GroupActive((uint8_t)AnimGroup::Intro)) this->CurPhase = Phase::Play;
+	};
 
-		if (DoSwipe) {
-			if (Swipe < 255) {
-				Swipe = std::lerp(Swipe, 255.0f, 0.1f);
-				Delay = 255 - Swipe;
+	this->CurPhase = Phase::Intro;
+	this->Anims.Add(this->Fade, 255.0f, 0.0f, 60, Animator::Ease::OutCubic, Done, (uint8_t)AnimGroup::Intro);
 
-				if (Swipe >= 254.95f) {
-					Delay = 0;
-					Swipe = 0;
-					DoSwipe = false;
-				}
-			}
-		}
+	switch(this->IntroType) {
+		case 1:
+			this->StartGameAnimationFalling(Done); // Falling.
+			break;
 
-		if ((CCard == ToInit) && (!DoSwipe)) Done = true; // Set to done when the move / fade delay is over.. and the cards too.
+		case 2:
+			this->StartGameAnimationGrowing(Done); // Growing.
+			break;
 	}
 }
 
 
-/* The Start Animation of the game. */
-void GameHelper::StartGameAnimation() {
-	if (_3DZwei::CFG->DoAnimation()) {
-		switch(_3DZwei::CFG->GameAnimation()) {
-			case 0:
-				{ // Random.
-					const uint8_t Idx = rand() % START_ANIMATION_AMOUNT + 1; // 1 - 2 currently.
-					switch(Idx) {
-						case 1:
-							this->StartGameAnimationFalling(); // Falling.
-							break;
-
-						case 2:
-							this->StartGameAnimationGrowing(); // Growing.
-							break;
-					}
-				}
-				break;
-
-			case 1:
-				this->StartGameAnimationFalling(); // Falling.
-				break;
+/*
+	Swipes from the current page to an other page.
 
-			case 2:
-				this->StartGameAnimationGrowing(); // Growing.
-				break;
-		}
-	}
+	const size_t Target: The page to swipe to.
+	const uint32_t Frames: The duration of the swipe.
+	const std::function<void()> &Done: Called, once the swipe is done.
+*/
+void GameHelper::SwipePage(const size_t Target, const uint32_t Frames, const std::function<void()> &Done) {
+	this->Swiping = true, this->SwipeTarget = Target;
+	this->FieldVersion++;
+	GFX::Invalidate();
+
+	this->Anims.Add(this->SwipePos, this->SwipePos, 320.0f, Frames, Animator::Ease::OutCubic, [this, Done]() {
+		this->Page = this->SwipeTarget, this->SwipePos = 0.0f, this->Swiping = false; // Set the new page.
+		this->FieldVersion++;
+		if (Done) Done();
+	}, (uint8_t)AnimGroup::Page);
 }
 
 
@@ -674,290 +711,39 @@ void GameHelper::StartGameAnimation() {
 */
 void GameHelper::PageAnimation(const bool Forward) {
 	const size_t NewPage = (Forward ? (this->Page + 1) : (this->Page - 1));
+	this->Mark("Page");
 
-	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->PageSwitch()) {
-		this->Page = NewPage;
-		return; // No Animation.
-	}
-
-	bool Done = false;
-	int SwipePos = 0;
-	float Cubic = 0.0f;
-
-	while(aptMainLoop() && !Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		GFX::DrawBottom();
-
-		/* Current Page site navigators. */
-		if (this->Page > 0) { // Because we can go back.
-			if (Forward) { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - SwipePos, 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 - SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - SwipePos, 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 - SwipePos, 110); // Now the arrow!
-
-			} else { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + SwipePos, 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 + SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + SwipePos, 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 + SwipePos, 110); // Now the arrow!
-			}
-		}
-
-		if (this->CanGoForward(this->Page)) { // Because we can go forward.
-			if (Forward) { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - SwipePos, 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 - SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - SwipePos, 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 - SwipePos, 110, -1.0f, 1.0f); // Now the arrow!
-
-			} else { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + SwipePos, 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 + SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + SwipePos, 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 + SwipePos, 110, -1.0f, 1.0f); // Now the arrow!
-			}
-		}
-
-		/* Prev / Next Page site navigators. */
-		if (NewPage > 0) { // Because we can go back.
-			if (Forward) {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + (320 - SwipePos), 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 + (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + (320 - SwipePos), 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 + (320 - SwipePos), 110); // Now the arrow!
-
-			} else {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - (320 - SwipePos), 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 - (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - (320 - SwipePos), 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 - (320 - SwipePos), 110); // Now the arrow!
-			}
-		}
-
-		if (this->CanGoForward(NewPage)) { // Because we can go forward.
-			if (Forward) {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + (320 - SwipePos), 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 + (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + (320 - SwipePos), 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 + (320 - SwipePos), 110, -1.0f, 1.0f); // Now the arrow!
-
-			} else {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - (320 - SwipePos), 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 - (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - (320 - SwipePos), 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 - (320 - SwipePos), 110, -1.0f, 1.0f); // Now the arrow!
-			}
-		}
-
-		/* Draw current Page cards. */
-		for (size_t Idx = (this->Page * 20), Idx2 = 0; Idx < (this->Page * 20) + 20 && Idx < (this->Game->GetPairs() * 2); Idx++, Idx2++) {
-			if (!this->Game->IsCardCollected(Idx)) {
-				if (Forward) { // Goes from <- to ->.
-					if (this->Game->IsCardShown(Idx)) GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X - SwipePos, this->CPos[Idx2].Y);
-					else Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X - SwipePos, this->CPos[Idx2].Y); // Back cover because hidden.
-
-
-				} else { // Goes from -> to <-.
-					if (this->Game->IsCardShown(Idx))
-						GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X + SwipePos, this->CPos[Idx2].Y);
-					else
-						Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X + SwipePos, this->CPos[Idx2].Y); // Back cover because hidden.
-				}
-			}
-		}
-
-		/* Draw new Page cards. */
-		for (size_t Idx = (NewPage * 20), Idx2 = 0; Idx < (NewPage * 20) + 20 && Idx < (this->Game->GetPairs() * 2); Idx++, Idx2++) {
-			if (!this->Game->IsCardCollected(Idx)) {
-				if (Forward) { // Goes from -> to <-.
-					if (this->Game->IsCardShown(Idx)) GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X + (320 - SwipePos), this->CPos[Idx2].Y);
-					else Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X + (320 - SwipePos), this->CPos[Idx2].Y); // Back cover because hidden.
-
-
-				} else { // Goes from <- to ->.
-					if (this->Game->IsCardShown(Idx))
-						GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X - (320 - SwipePos), this->CPos[Idx2].Y);
-					else
-						Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X - (320 - SwipePos), this->CPos[Idx2].Y); // Back cover because hidden.
-				}
-			}
-		}
-
-		C3D_FrameEnd(0);
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) Done = true;
-
-		if (Cubic < 320.0f) { // Page Switch handle.
-			Cubic = std::lerp(Cubic, 321.0f, 0.3f);
-
-			SwipePos = Cubic;
-			if (Cubic >= 320.0f) Done = true;
-		}
-	}
-
-	this->Page = NewPage; // Set the new page.
+	this->SwipePage(NewPage, (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->PageSwitch()) ? 16 : 0);
 }
 
 
 /*
 	The Page Switching Animation for the AI.
+	Swipes page by page, or directly, if the page is too far away.
 
-	const int Page: The page which to go to.
-
-	TODO: Make this better???
+	const size_t Page: The page which to go to.
+	const std::function<void()> &Done: Called, once the target page is reached.
 */
-void GameHelper::AIPageAnimation(const int Page) {
+void GameHelper::AIPageAnimation(const size_t Page, const std::function<void()> &Done) {
 	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->PageSwitch()) {
-		this->Page = Page;
+		this->Page = Page, this->FieldVersion++;
+		if (Done) Done();
 		return; // No Animation.
 	}
 
-	const bool Forward = ((int)this->Page < Page);
-	size_t Pages = (Forward ? (Page - (int)this->Page) : ((int)this->Page - Page)); // The amount of pages to go forward / backward.
-	int SwipePos = 0;
-	float Cubic = 0.0f, ScrollSpeed = 0.3f;
-	const bool JumpDirect = Pages >= 16; // 16+ -> Jump DIRECTLY to the page.
-
-	/* Set Scroll speed. */
-	if (Pages <= 5) ScrollSpeed = 0.3f; // 1 - 5 -> Normal speed.
-	else if (Pages >= 6 && Pages <= 15) ScrollSpeed = 0.6f; // Fast speed.
-
-	while(aptMainLoop() && Pages > 0) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		GFX::DrawBottom();
-
-		/* Current Page site navigators. */
-		if (this->Page > 0) { // Because we can go back.
-			if (Forward) { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - SwipePos, 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 - SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - SwipePos, 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 - SwipePos, 110); // Now the arrow!
-
-			} else { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + SwipePos, 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 + SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + SwipePos, 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 + SwipePos, 110); // Now the arrow!
-			}
-		}
-
-		if (this->CanGoForward(this->Page)) { // Because we can go forward.
-			if (Forward) { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - SwipePos, 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 - SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - SwipePos, 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 - SwipePos, 110, -1.0f, 1.0f); // Now the arrow!
-
-			} else { // Goes from <- to ->.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + SwipePos, 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 + SwipePos, 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + SwipePos, 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 + SwipePos, 110, -1.0f, 1.0f); // Now the arrow!
-			}
-		}
-
-
-		/* Prev / Next Page site navigators. */
-		/* Check if we can go back. */
-		bool Check = (JumpDirect ? Page > 0 : ((Forward ? this->Page + 1 : this->Page - 1) > 0));
-
-		if (Check) {
-			if (Forward) {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + (320 - SwipePos), 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 + (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 + (320 - SwipePos), 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 + (320 - SwipePos), 110); // Now the arrow!
-
-			} else {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - (320 - SwipePos), 0); // Draw the small top corner.
-				Gui::Draw_Rect(0 - (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0 - (320 - SwipePos), 220, 1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 0 - (320 - SwipePos), 110); // Now the arrow!
-			}
-		}
-
-		/* Check if we can go forward. */
-		Check = (JumpDirect ? this->CanGoForward(Page) : this->CanGoForward((Forward ? this->Page + 1 : this->Page -1)));
-
-		if (Check) {
-			if (Forward) {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + (320 - SwipePos), 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 + (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 + (320 - SwipePos), 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 + (320 - SwipePos), 110, -1.0f, 1.0f); // Now the arrow!
-
-			} else {
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - (320 - SwipePos), 0, -1.0f, 1.0f); // Draw the small top corner.
-				Gui::Draw_Rect(300 - (320 - SwipePos), 20, 20, 200, BAR_BLUE); // Draw the Middle corner bar.
-				Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 300 - (320 - SwipePos), 220, -1.0f, -1.0f); // Draw the small bottom corner.
-				Gui::DrawSprite(GFX::Sprites, sprites_arrow_idx, 300 - (320 - SwipePos), 110, -1.0f, 1.0f); // Now the arrow!
-			}
-		}
-
-		/* Draw current Page cards. */
-		for (size_t Idx = (this->Page * 20), Idx2 = 0; Idx < (this->Page * 20) + 20 && Idx < (this->Game->GetPairs() * 2); Idx++, Idx2++) {
-			if (!this->Game->IsCardCollected(Idx)) {
-				if (Forward) { // Goes from <- to ->.
-					if (this->Game->IsCardShown(Idx)) GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X - SwipePos, this->CPos[Idx2].Y);
-					else Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X - SwipePos, this->CPos[Idx2].Y); // Back cover because hidden.
-
-
-				} else { // Goes from -> to <-.
-					if (this->Game->IsCardShown(Idx))
-						GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X + SwipePos, this->CPos[Idx2].Y);
-					else
-						Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X + SwipePos, this->CPos[Idx2].Y); // Back cover because hidden.
-				}
-			}
-		}
-
-		const size_t PG = (JumpDirect ? Page : (Forward ? this->Page + 1 : this->Page - 1)); // Get page to draw.
-
-		/* Draw next Page cards. */
-		for (size_t Idx = (PG * 20), Idx2 = 0; Idx < (PG * 20) + 20 && Idx < (this->Game->GetPairs() * 2); Idx++, Idx2++) {
-			if (!this->Game->IsCardCollected(Idx)) {
-				if (Forward) { // Goes from -> to <-.
-					if (this->Game->IsCardShown(Idx)) GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X + (320 - SwipePos), this->CPos[Idx2].Y);
-					else Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X + (320 - SwipePos), this->CPos[Idx2].Y); // Back cover because hidden.
+	const bool Forward = (this->Page < Page);
+	const size_t Pages = (Forward ? (Page - this->Page) : (this->Page - Page)); // The amount of pages to go forward / backward.
+	const uint32_t Frames = (Pages <= 5 ? 16 : 6); // 1 - 5 -> Normal speed, 6+ -> Fast speed.
 
-
-				} else { // Goes from <- to ->.
-					if (this->Game->IsCardShown(Idx))
-						GFX::DrawCard(this->Game->GetCardType(Idx), this->CPos[Idx2].X - (320 - SwipePos), this->CPos[Idx2].Y);
-					else
-						Gui::DrawSprite(GFX::Cards, Utils::GetCardSheetSize(), this->CPos[Idx2].X - (320 - SwipePos), this->CPos[Idx2].Y); // Back cover because hidden.
-				}
-			}
-		}
-
-		C3D_FrameEnd(0);
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) break; // Stop Animation if any key pressed.
-
-		if (Cubic < 320.0f) { // Page Switch handle.
-			Cubic = std::lerp(Cubic, 321.0f, ScrollSpeed);
-			SwipePos = Cubic;
-
-			if (Cubic >= 320.0f) {
-				if (JumpDirect) Pages = 0; // Direct Jump.
-				else SwipePos = 0, Cubic = 0.0f, this->Page = (Forward ? this->Page + 1 : this->Page - 1), Pages--;
-			}
-		}
+	if (Pages >= 16) { // 16+ -> Jump DIRECTLY to the page.
+		this->SwipePage(Page, Frames, Done);
+		return;
 	}
 
-	this->Page = Page; // Set the new page.
+	this->SwipePage((Forward ? this->Page + 1 : this->Page - 1), Frames, [this, Page, Done]() {
+		if (this->Page != Page) this->AIPageAnimation(Page, Done); // Next page.
+		else if (Done) Done();
+	});
 }
 
 
@@ -967,373 +753,287 @@ void GameHelper::AIPageAnimation(const int Page) {
 	const size_t Idx: The index which to pick.
 */
 void GameHelper::PickAnimation(const size_t Idx) {
-	if (!this->Game->IsCardShown((Idx))) { // Make sure it is NOT shown at all.
-		this->Game->DoPlay(Idx); // Play.
-		const uint8_t Idx = (this->Game->GetState() == StackMem::TurnState::DoCheck ? 1 : 0);
-
-		if (!_3DZwei::CFG->DoAnimation()) {
-			this->CardClicked[Idx] = true;
-			return; // No Animation.
-		}
-
-		float Cubic = 0.0f;
-		bool Done = false;
-
-		while(aptMainLoop() && !Done) {
-			Gui::clearTextBufs();
-			C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-			C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-			C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-			this->DrawTop();
-			this->DrawField(false);
-			C3D_FrameEnd(0);
-
-			if (!this->CardClicked[Idx]) { // Scale down the back cover -- first operation.
-				if (Cubic < 0.95f) {
-					Cubic = std::lerp(Cubic, 2.0f, 0.1f);
-
-					this->ClickedScale[Idx] = 1.0f - Cubic;
-
-					if (Cubic >= 0.95f) {
-						Cubic = 0.0f;
-						this->ClickedScale[Idx] = 0.0f;
-						this->CardClicked[Idx] = true;
-					}
-				}
-
-			} else { // Scale up the front cover -- second operation.
-				if (Cubic < 0.95f) {
-					Cubic = std::lerp(Cubic, 2.0f, 0.1f);
-					this->ClickedScale[Idx] = Cubic;
-
-					if (Cubic >= 0.95f) {
-						this->ClickedScale[Idx] = 1.0f;
-						Done = true;
-					}
-				}
-			}
-		}
-	}
-
-	this->RefreshFrame = true; // Refresh the frame.
+	if (this->Game->IsCardShown(Idx)) return; // Make sure it is NOT shown at all.
+
+	this->Game->DoPlay(Idx); // Play.
+	this->FieldVersion++;
+	GFX::Invalidate();
+	const uint8_t Turn = (this->Game->GetState() == StackMem::TurnState::DoCheck ? 1 : 0);
+	const uint32_t Frames = (_3DZwei::CFG->DoAnimation() ? 8 : 0);
+	this->Mark("Flip");
+
+	/* Scale down the back cover, then scale up the front cover. */
+	this->CardClicked[Turn] = false;
+	this->Anims.Add(this->ClickedScale[Turn], 1.0f, 0.0f, Frames, Animator::Ease::OutQuad, [this, Turn, Frames]() {
+		this->CardClicked[Turn] = true;
+
+		this->Anims.Add(this->ClickedScale[Turn], 0.0f, 1.0f, Frames, Animator::Ease::OutQuad, nullptr, (uint8_t)AnimGroup::Cards);
+	}, (uint8_t)AnimGroup::Cards);
 }
 
 
 /*
 	If the two cards did not match -> Hide them again.
-*/
-void GameHelper::HideAnimation() {
-	if (!_3DZwei::CFG->DoAnimation()) {
-		this->CardClicked[0] = false, this->CardClicked[1] = false;
-		return; // No Animation.
-	}
-
-	bool Done = false;
-	float Cubic = 0.0f;
-
-	while(aptMainLoop() && !Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		this->DrawField(false);
-		C3D_FrameEnd(0);
-
-		if (this->CardClicked[0]) { // Front cover handle.
-			if (Cubic < 0.95f) {
-				Cubic = std::lerp(Cubic, 2.0f, 0.1f);
-
-				this->ClickedScale[0] = 1.0f - Cubic;
-				this->ClickedScale[1] = 1.0f - Cubic;
-
-				if (Cubic >= 0.95f) {
-					Cubic = 0.0f;
-					this->ClickedScale[0] = 0.0f, this->ClickedScale[1] = 0.0f;
-					this->CardClicked[0] = false, this->CardClicked[1] = false;
-				}
-			}
 
-		} else { // Back cover handle.
-			if (Cubic < 0.95f) {
-				Cubic = std::lerp(Cubic, 2.0f, 0.1f);
-
-				this->ClickedScale[0] = Cubic;
-				this->ClickedScale[1] = Cubic;
+	const std::function<void()> &Done: Called, once both cards are hidden.
+*/
+void GameHelper::HideAnimation(const std::function<void()> &Done) {
+	const uint32_t Frames = (_3DZwei::CFG->DoAnimation() ? 8 : 0);
 
-				if (Cubic >= 0.95f) {
-					this->ClickedScale[0] = 1.0f, this->ClickedScale[1] = 1.0f;
-					Done = true;
-				}
-			}
-		}
-	}
+	/* Scale down both front covers, then scale up the back covers. */
+	this->Anims.Add(this->ClickedScale[0], 1.0f, 0.0f, Frames, Animator::Ease::OutQuad, nullptr, (uint8_t)AnimGroup::Cards);
+	this->Anims.Add(this->ClickedScale[1], 1.0f, 0.0f, Frames, Animator::Ease::OutQuad, [this, Frames, Done]() {
+		this->CardClicked[0] = false, this->CardClicked[1] = false;
 
-	this->RefreshFrame = true;
+		this->Anims.Add(this->ClickedScale[0], 0.0f, 1.0f, Frames, Animator::Ease::OutQuad, nullptr, (uint8_t)AnimGroup::Cards);
+		this->Anims.Add(this->ClickedScale[1], 0.0f, 1.0f, Frames, Animator::Ease::OutQuad, Done, (uint8_t)AnimGroup::Cards);
+	}, (uint8_t)AnimGroup::Cards);
 }
 
 
 /*
 	If you collected a pair, shrink both cards out.
-*/
-void GameHelper::ShrinkAnimation() {
-	if (!_3DZwei::CFG->DoAnimation()) {
-		this->CardClicked[0] = false, this->CardClicked[1] = false;
-		this->ClickedScale[0] = 0.0f, this->ClickedScale[1] = 0.0f;
-		this->RefreshFrame = true;
-		return; // No Animation.
-	}
 
-	bool Done = false;
-	float Cubic = 0.0f;
-
-	while(aptMainLoop() && !Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		this->DrawField(false);
-		C3D_FrameEnd(0);
-
-		if (this->CardClicked[0]) { // Let both cards shrink and disappear.
-			if (Cubic < 0.95f) {
-				Cubic = std::lerp(Cubic, 2.0f, 0.1f);
-
-				this->ClickedScale[0] = 1.0f - Cubic;
-				this->ClickedScale[1] = 1.0f - Cubic;
-
-				if (Cubic >= 0.95f) {
-					/* Reset both values properly. */
-					this->ClickedScale[0] = 0.0f, this->ClickedScale[1] = 0.0f;
-					this->CardClicked[0] = false, this->CardClicked[1] = false;
-					Done = true;
-				}
-			}
-		}
-	}
+	const std::function<void()> &Done: Called, once both cards are gone.
+*/
+void GameHelper::ShrinkAnimation(const std::function<void()> &Done) {
+	const uint32_t Frames = (_3DZwei::CFG->DoAnimation() ? 8 : 0);
 
-	this->RefreshFrame = true; // Refresh the frame.
+	this->Anims.Add(this->ClickedScale[0], 1.0f, 0.0f, Frames, Animator::Ease::OutQuad, nullptr, (uint8_t)AnimGroup::Cards);
+	this->Anims.Add(this->ClickedScale[1], 1.0f, 0.0f, Frames, Animator::Ease::OutQuad, [this, Done]() {
+		/* Reset both values properly. */
+		this->ClickedScale[0] = 0.0f, this->ClickedScale[1] = 0.0f;
+		this->CardClicked[0] = false, this->CardClicked[1] = false;
+		this->PairBurst();
+		if (Done) Done();
+	}, (uint8_t)AnimGroup::Cards);
 }
 
 
 /*
 	The End-Game Animation.
 	Basically fades out the screen and swipes the characters out.
-*/
-void GameHelper::EndGameAnimation() {
-	if (!_3DZwei::CFG->DoAnimation()) return; // No Animation.
-
-	bool Done = false;
-	int Delay = 0;
-	float Cubic = 0.0f;
 
-	while(aptMainLoop() && !Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-
-		GFX::DrawTop();
-		/* Draw First character. It's included in both play modes. */
-		if (this->Params.Characters[0] < Utils::GetCharSheetSize()) {
-			Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30 - Delay, 30);
-		}
-
-		/* Draw Second character. It's only included in Versus Mode.. */
-		if (this->Params.GameMode == GameSettings::GameModes::Versus) {
-			if (this->Params.Characters[1] < Utils::GetCharSheetSize()) {
-				Gui::DrawSprite(GFX::Characters, this->Params.Characters[1], 250 + Delay, 30);
-			}
-		}
+	const std::function<void()> &Done: Called, once the animation is done.
+*/
+void GameHelper::EndGameAnimation(const std::function<void()> &Done) {
+	this->CurPhase = Phase::Outro;
+	this->Anims.Add(this->Fade, 0.0f, 255.0f, (_3DZwei::CFG->DoAnimation() ? 60 : 0), Animator::Ease::OutCubic, Done, (uint8_t)AnimGroup::Outro);
+}
 
-		if (Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, Delay));
-		GFX::DrawBottom();
-		if (Delay > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, Delay));
-		C3D_FrameEnd(0);
 
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) Done = true; // You can always skip this by pressing any key, if it's too long for you.
+/* Advances all running animations. Call this ONCE per frame. */
+void GameHelper::Tick() {
+	if (this->Anims.Busy()) GFX::Invalidate();
+	const bool CardsMoved = this->Anims.GroupActive((uint8_t)AnimGroup::Cards);
 
-		/* Fade and Move Logic. */
-		if (!Done) {
-			if (Cubic < 255.0f) {
-				Cubic = std::lerp(Cubic, 256.0f, 0.1f);
-				Delay = Cubic;
+	this->Anims.Tick(Clock::Frames());
+	if (CardsMoved) this->FieldVersion++; // The card scales or states changed.
 
-				if (Cubic >= 255.0f) {
-					Delay = 0;
-					Done = true;
-				}
-			}
-		}
+	if (this->Effects.Active()) {
+		this->Effects.Tick(Clock::Frames());
+		GFX::Invalidate();
 	}
 }
 
 
 /*
 	This is called, when both cards are played.
-
-	This returns the following states:
-		P1 Wins: GameHelper::LogicState::P1Won.
-		P2 Wins: GameHelper::LogicState::P2Won.
-		No one Wins: GameHelper::LogicState::Tie.
-		Not even over yet: GameHelper::LogicState::Nothing.
+	The result is applied once the cards are hidden or shrinked. If the game is over, GameHelper::Logic returns the result
+	after the End-Game Animation.
 */
-GameHelper::LogicState GameHelper::TurnChecks() {
+void GameHelper::TurnChecks() {
+	this->FieldVersion++;
+	GFX::Invalidate();
+	this->Turns++;
+
 	if (this->Game->DoCheck(false)) { // Do not hide the cards directly there.
 		/* Check if over. */
 		if (this->Game->CheckGameState() != StackMem::GameState::NotOver) {
-			this->ShrinkAnimation(); // Shrink cards.
-
-			const StackMem::GameState Res = this->Game->CheckGameState();
-			switch(Res) {
-				case StackMem::GameState::NotOver:
-					break;
+			this->ShrinkAnimation([this]() {
+				const StackMem::GameState Res = this->Game->CheckGameState();
 
-				case StackMem::GameState::Tie:
-				case StackMem::GameState::Player1:
-				case StackMem::GameState::Player2: { // All 3 states are valid end states.
-					/* Set Pairs. */
-					this->Params.PlayerPairs[0] = this->Game->GetPlayerPairs(StackMem::Players::Player1);
-					this->Params.PlayerPairs[1] = this->Game->GetPlayerPairs(StackMem::Players::Player2);
-					this->EndGameAnimation(); // The game is over.
+				/* Set Pairs. */
+				this->Params.PlayerPairs[0] = this->Game->GetPlayerPairs(StackMem::Players::Player1);
+				this->Params.PlayerPairs[1] = this->Game->GetPlayerPairs(StackMem::Players::Player2);
+				Stats::AddRound(this->Params, this->Game->GetPairs(), this->Turns, this->Misses, this->Starter, Res);
+				Stats::Sav(); // This is the logic thread, so the write doesn't stall the drawing.
 
+				this->EndGameAnimation([this, Res]() { // The game is over.
 					switch(Res) {
 						case StackMem::GameState::Tie:
-							return GameHelper::LogicState::Tie;
+							this->Result = GameHelper::LogicState::Tie;
+							break;
 
 						case StackMem::GameState::Player1:
-							return GameHelper::LogicState::P1Won;
+							this->Result = GameHelper::LogicState::P1Won;
+							break;
 
 						case StackMem::GameState::Player2:
-							return GameHelper::LogicState::P2Won;
+							this->Result = GameHelper::LogicState::P2Won;
+							break;
 
 						case StackMem::GameState::NotOver:
-							return GameHelper::LogicState::Nothing;
+							break;
 					}
-
-					break;
-				}
-			}
+				});
+			});
 
 		} else { // A pair is collected, so shrink the cards + reset the state.
-			this->ShrinkAnimation();
-			/* We collected the cards. */
-			this->Game->SetCardCollected(this->Game->GetTurnCard(0), true); this->Game->SetCardCollected(this->Game->GetTurnCard(1), true);
-			this->Game->ResetTurn(true); // Only reset state, don't hide cards.
-			this->ClickedScale[0] = 1.0f, this->ClickedScale[1] = 1.0f; // Reset too, just in case.
-			this->Game->SetState(StackMem::TurnState::DrawFirst); // We were able to play a card, so let us continue!
+			this->ShrinkAnimation([this]() {
+				/* We collected the cards. */
+				this->Game->SetCardCollected(this->Game->GetTurnCard(0), true); this->Game->SetCardCollected(this->Game->GetTurnCard(1), true);
+				this->Game->ResetTurn(true); // Only reset state, don't hide cards.
+				this->ClickedScale[0] = 1.0f, this->ClickedScale[1] = 1.0f; // Reset too, just in case.
+				this->Game->SetState(StackMem::TurnState::DrawFirst); // We were able to play a card, so let us continue!
+			});
 		}
 
 	} else { // Both cards do not match, hide them + reset the state.
-		this->HideAnimation();
-		this->Game->ResetTurn(false); // Hide cards, reset state.
+		this->Misses++;
 
-		/* At this point, we need to make an exception for Solo and Versus Mode. */
-		if (this->Params.GameMode == GameSettings::GameModes::Solo) { // Solo Mode.
-			this->Params.Guesses[1]++; // Increase the missed guesses.
-			this->Game->SetState(StackMem::TurnState::DrawFirst); // Set first State again.
+		this->HideAnimation([this]() {
+			this->Game->ResetTurn(false); // Hide cards, reset state.
 
-		} else { // Normal Mode.
-			this->Game->NextPlayer(); // Nah, no match. Next player!
-		}
+			/* At this point, we need to make an exception for Solo and Versus Mode. */
+			if (this->Params.GameMode == GameSettings::GameModes::Solo) { // Solo Mode.
+				this->Params.Guesses[1]++; // Increase the missed guesses.
+				this->Game->SetState(StackMem::TurnState::DrawFirst); // Set first State again.
+
+			} else { // Normal Mode.
+				this->Game->NextPlayer(); // Nah, no match. Next player!
+			}
+		});
 	}
 
 	if (this->Params.GameMode == GameSettings::GameModes::Solo) this->Params.Guesses[0]++; // Increase the total guesses.
-	this->RefreshFrame = true; // Refresh frame.
-	return GameHelper::LogicState::Nothing; // Nothing special.
+}
+
+
+/*
+	Handles the card delay without blocking.
+	Starts the delay timer on the first call and returns true, once it expired or got skipped by pressing any key.
+
+	const uint32_t Down: The Input::Down() variable.
+*/
+bool GameHelper::DelayDone(const uint32_t Down) {
+	if (!this->CardTimer.Armed()) {
+		this->CardTimer.Start(this->Params.CardDelay);
+		return false;
+	}
+
+	if (!Down && !this->CardTimer.Expired()) return false;
+
+	this->CardTimer.Stop();
+	return true;
+}
+
+
+/* If a card or page animation is still running. */
+bool GameHelper::CardsBusy() const {
+	return (this->Anims.GroupActive((uint8_t)AnimGroup::Cards) || this->Anims.GroupActive((uint8_t)AnimGroup::Page));
+}
+
+
+/*
+	If the logic can handle a press right now.
+	While the turn cards get hidden or collected, presses have to wait, so they stay queued for the next turn.
+*/
+bool GameHelper::WantsInput() const {
+	if (this->CurPhase != Phase::Play || this->Result != GameHelper::LogicState::Nothing) return true; // Skips the animation.
+	return !(this->Game->GetState() == StackMem::TurnState::DoCheck && this->CardsBusy());
+}
+
+
+/* If the current player picks the cards right now, so a touch is a tap on the Gamefield and not any key. */
+bool GameHelper::Picking() const {
+	if (this->CurPhase != Phase::Play || this->Result != GameHelper::LogicState::Nothing) return false;
+	if (this->Game->GetState() == StackMem::TurnState::DoCheck) return false;
+
+	return !(this->Params.GameMode != GameSettings::GameModes::Solo && this->Game->AIEnabled() &&
+		this->Game->GetCurrentPlayer() == StackMem::Players::Player2);
 }
 
 
 /*
 	Normal Player Logic.
 */
-GameHelper::LogicState GameHelper::PlayerLogic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition T) {
+GameHelper::LogicState GameHelper::PlayerLogic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const Gesture::Type G) {
 	Pointer::ScrollHandling(Held, true); // Scrolling handle.
 
+	const size_t Cards = this->Game->GetPairs() * 2, PerPage = this->Layout.PerPage(), Cols = this->Layout.Cols();
+
 	if (Repeat & KEY_L) this->PrevPage();
 	if (Repeat & KEY_R) {
 		if (this->NextPage()) {
-			if ((this->Page * 20) + this->Selection + 1 > this->Game->GetPairs() * 2) { // Ensureness.
-				this->Selection = ((this->Game->GetPairs() * 2) - 1) % 20;
-			}
-
-			Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
+			if ((this->TargetPage() * PerPage) + this->Selection + 1 > Cards) this->SelectCard((Cards - 1) % PerPage); // Ensureness.
+			else this->SelectCard(this->Selection);
 		}
 	}
 
 	if (Repeat & KEY_DDOWN) {
 		if (!Pointer::Show) Pointer::Show = true;
 
-		if (this->Selection < 15) { // 15 --> 4th row first card.
-			if ((this->Page * 20) + this->Selection + 5 < this->Game->GetPairs() * 2) { // Ensureness.
-				this->Selection += 5;
-				Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
-			}
+		if (this->Selection + Cols < PerPage) { // Not on the last row.
+			if ((this->TargetPage() * PerPage) + this->Selection + Cols < Cards) this->SelectCard(this->Selection + Cols); // Ensureness.
 		}
 	}
 
 	if (Repeat & KEY_DUP) {
 		if (!Pointer::Show) Pointer::Show = true;
-
-		if (this->Selection > 4) { // 4 --> 1st row last card.
-			this->Selection -= 5;
-			Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
-		}
+		if (this->Selection >= Cols) this->SelectCard(this->Selection - Cols); // Not on the first row.
 	}
 
 	if (Repeat & KEY_DLEFT) {
 		if (!Pointer::Show) Pointer::Show = true;
 
-		if (this->Selection == 0 || this->Selection == 5 || this->Selection == 10 || this->Selection == 15) {
-			this->PrevPage();
-			this->Selection += 4; // Go to the whole right.
-			Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
+		if (this->Selection % Cols == 0) { // First card of a row.
+			if (this->PrevPage()) this->SelectCard(this->Selection + Cols - 1); // Go to the whole right.
 
 		} else {
-			if (this->Selection > 0) {
-				this->Selection--;
-				Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
-			}
+			this->SelectCard(this->Selection - 1);
 		}
 	}
 
 	if (Repeat & KEY_DRIGHT) {
 		if (!Pointer::Show) Pointer::Show = true;
 
-		if (this->Selection < 20) {
-			if (this->Selection == 4 || this->Selection == 9 || this->Selection == 14 || this->Selection == 19) {
-				if (this->NextPage()) {
-					this->Selection -= 4;
-
-					if ((this->Page * 20) + this->Selection + 1 > this->Game->GetPairs() * 2) { // Ensureness.
-						this->Selection = ((this->Game->GetPairs() * 2) - 1) % 20;
-					}
-
-					Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
-				}
+		if (this->Selection % Cols == Cols - 1) { // Last card of a row.
+			if (this->NextPage()) {
+				const size_t Slot = this->Selection - (Cols - 1);
 
-			} else {
-				if ((this->Page * 20) + this->Selection + 1 < this->Game->GetPairs() * 2) { // Ensureness.
-					this->Selection++;
-					Pointer::SetPos(this->CPos[this->Selection].X + 18, this->CPos[this->Selection].Y + 19);
-				}
+				if ((this->TargetPage() * PerPage) + Slot + 1 > Cards) this->SelectCard((Cards - 1) % PerPage); // Ensureness.
+				else this->SelectCard(Slot);
 			}
+
+		} else {
+			if ((this->TargetPage() * PerPage) + this->Selection + 1 < Cards) this->SelectCard(this->Selection + 1); // Ensureness.
 		}
 	}
 
 	if (Repeat & KEY_A) {
-		for (auto &Position : this->CPos) {
-			if (Pointer::Clicked(Position, true)) return GameHelper::LogicState::Nothing;
+		if (this->Press(Pointer::HitX(), Pointer::HitY()) && !Pointer::Show) Pointer::Show = true; // Show pointer, if clicked.
+	}
+
+	if (G == Gesture::Type::Press) { // The page buttons are off the cards, so they don't wait for a tap.
+		const int Button = this->PageButtonsIndex.Find(this->Touch.StartX(), this->Touch.StartY());
+
+		if (Button >= 0) {
+			this->Cause = this->TouchFrame;
+			this->PageButtons[Button].Func();
+			this->Touch.Cancel();
 		}
 	}
 
-	if (Repeat & KEY_TOUCH) {
-		for (auto &Position : this->CPos) {
-			if (Touched(Position, T, true)) return GameHelper::LogicState::Nothing;
+	if (G == Gesture::Type::Drag) this->DragPage(this->Touch.DX());
+
+	if (this->TapTimer.Armed()) { // A tap, which might be from the end of the previous turn.
+		if (!this->TapTimer.Expired()) {
+			this->Cause = this->TouchFrame;
+			this->Press(this->TapX, this->TapY);
 		}
+
+		this->TapTimer.Stop();
 	}
 
 	return GameHelper::LogicState::Nothing;
@@ -1345,33 +1045,26 @@ GameHelper::LogicState GameHelper::PlayerLogic(const uint32_t Down, const uint32
 */
 GameHelper::LogicState GameHelper::AILogic(const uint32_t Down) {
 	if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) { // Play with card delay.
-		if (this->RefreshFrame) {
-			this->RefreshFrame = false;
-			return GameHelper::LogicState::Nothing;
-		}
-
-		for (size_t Idx = 0; Idx < this->Params.CardDelay; Idx++) { gspWaitForVBlank(); }; // Delay.
+		if (!this->DelayDone(Down)) return GameHelper::LogicState::Nothing; // Delay.
 		const size_t Card = this->Game->AIPlay();
 
-		/* Switch to proper pages. */
-		const size_t NewPage = (Card / 20);
-		if (NewPage != this->Page) this->AIPageAnimation(NewPage);
+		this->SelectCard(Card % this->Layout.PerPage());
 
-		this->PickAnimation(Card);
-		this->Selection = (Card % 20);
-		Pointer::SetPos(this->CPos[this->Selection].X + 10, this->CPos[this->Selection].Y + 10);
+		/* Switch to proper pages, then pick. */
+		const size_t NewPage = (Card / this->Layout.PerPage());
+		if (NewPage != this->Page) this->AIPageAnimation(NewPage, [this, Card]() { this->PickAnimation(Card); });
+		else this->PickAnimation(Card);
 
 	} else { // We don't have a valid card delay set, so handle through click.
 		if (Down) {
 			const size_t Card = this->Game->AIPlay();
 
-			/* Switch to proper pages. */
-			const size_t NewPage = (Card / 20);
-			if (NewPage != this->Page) this->AIPageAnimation(NewPage);
+			this->SelectCard(Card % this->Layout.PerPage());
 
-			this->PickAnimation(Card);
-			this->Selection = (Card % 20);
-			Pointer::SetPos(this->CPos[this->Selection].X + 10, this->CPos[this->Selection].Y + 10);
+			/* Switch to proper pages, then pick. */
+			const size_t NewPage = (Card / this->Layout.PerPage());
+			if (NewPage != this->Page) this->AIPageAnimation(NewPage, [this, Card]() { this->PickAnimation(Card); });
+			else this->PickAnimation(Card);
 		}
 	}
 
@@ -1382,10 +1075,11 @@ GameHelper::LogicState GameHelper::AILogic(const uint32_t Down) {
 /*
 	Only THIS function SHOULD be called.
 
-	const uint32_t Down: The hidKeysDown() variable.
-	const uint32_t Held: The hidKeysHeld() variable.
-	const uint32_t Repeat: The hidKeysDownRepeat variable.
-	const touchPosition T: The touchPosition variable.
+	const uint32_t Down: The Input::Down() variable.
+	const uint32_t Held: The Input::Held() variable.
+	const uint32_t Repeat: The Input::Repeat() variable.
+	const touchPosition T: The current touch position, it goes through the gesture recognizer each frame.
+	const uint32_t PressFrame: The frame the press of Down and Repeat got scanned on, for the latency measurement.
 
 	This returns the following states:
 		P1 Wins: GameHelper::LogicState::P1Won.
@@ -1393,7 +1087,36 @@ GameHelper::LogicState GameHelper::AILogic(const uint32_t Down) {
 		No one Wins: GameHelper::LogicState::Tie.
 		Not even over yet: GameHelper::LogicState::Nothing.
 */
-GameHelper::LogicState GameHelper::Logic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition T) {
+GameHelper::LogicState GameHelper::Logic(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition T, const uint32_t PressFrame) {
+	const Gesture::Type G = this->Touch.Update(Held, T);
+	if (G == Gesture::Type::Press) this->TouchFrame = Input::ScanFrame(); // Gestures act on the live touch.
+
+	if (G == Gesture::Type::Tap || G == Gesture::Type::LongPress) { // A card held still picks without waiting for the release.
+		this->TapX = this->Touch.StartX(), this->TapY = this->Touch.StartY();
+		this->TapTimer.Start(TAP_WAIT);
+	}
+
+	if (G == Gesture::Type::Swipe || G == Gesture::Type::Flick || G == Gesture::Type::Release) {
+		this->Cause = this->TouchFrame;
+		this->DropPage(G != Gesture::Type::Release);
+	}
+
+	this->Cause = ((Down || Repeat) ? PressFrame : 0); // A press without a visible change doesn't stay pending.
+
+	if ((Down & KEY_TOUCH) && !this->Picking()) { // The touch continues the game like any key, so it's no tap anymore.
+		this->Touch.Cancel();
+		this->TapTimer.Stop();
+	}
+
+	if (this->CurPhase != Phase::Play || this->Result != GameHelper::LogicState::Nothing) {
+		/* You can always skip the Start and End Animation by pressing any key. */
+		if (Down) this->Anims.CancelGroup((uint8_t)(this->CurPhase == Phase::Intro ? AnimGroup::Intro : AnimGroup::Outro), true);
+
+		const GameHelper::LogicState State = this->Result; // Set, once the End-Game Animation is done.
+		this->Result = GameHelper::LogicState::Nothing;
+		return State;
+	}
+
 	if (Down & KEY_START || Down & KEY_SELECT) {
 		this->Params.CancelGame = true;
 		return GameHelper::LogicState::Nothing;
@@ -1401,26 +1124,21 @@ GameHelper::LogicState GameHelper::Logic(const uint32_t Down, const uint32_t Hel
 
 	if (this->Params.GameMode == GameSettings::GameModes::Solo) { // Least amount of tries play mode.
 		if (this->Game->GetState() != StackMem::TurnState::DoCheck) { // As long as the State is not check, we can play.
-			this->PlayerLogic(Down, Held, Repeat, T);
+			this->PlayerLogic(Down, Held, Repeat, G);
 
 		} else { // We are in the DoCheck state, so check.
-			if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) { // Use the card delay.
-				if (this->RefreshFrame) {
-					this->RefreshFrame = false;
-					return GameHelper::LogicState::Nothing;
-				}
+			if (this->CardsBusy()) return GameHelper::LogicState::Nothing; // Wait until both cards are fully turned.
 
-				if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) {
-					for (size_t Idx = 0; Idx < this->Params.CardDelay; Idx++) { gspWaitForVBlank(); }; // Do the delay, if enabled.
-				}
+			if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) { // Use the card delay.
+				if (!this->DelayDone(Down)) return GameHelper::LogicState::Nothing; // Do the delay.
 
-				const GameHelper::LogicState State = this->TurnChecks();
-				return State;
+				this->TurnChecks();
+				return GameHelper::LogicState::Nothing;
 
 			} else { // We don't have a valid card delay set, so handle through click.
 				if (Down) {
-					const GameHelper::LogicState State = this->TurnChecks();
-					return State;
+					this->TurnChecks();
+					return GameHelper::LogicState::Nothing;
 				}
 			}
 		}
@@ -1429,32 +1147,34 @@ GameHelper::LogicState GameHelper::Logic(const uint32_t Down, const uint32_t Hel
 	} else {
 		if (this->Game->GetState() != StackMem::TurnState::DoCheck) { // As long as the State is not check, we can play.
 			/* Player 1 is ALWAYS a player. */
-			if (this->Game->GetCurrentPlayer() == StackMem::Players::Player1) return this->PlayerLogic(Down, Held, Repeat, T);
+			if (this->Game->GetCurrentPlayer() == StackMem::Players::Player1) return this->PlayerLogic(Down, Held, Repeat, G);
 
 			/* Player 2 Logic. */
 			else {
-				if (this->Game->AIEnabled()) return this->AILogic(Down); // It's the AI's turn.
-				else return this->PlayerLogic(Down, Held, Repeat, T); // It's the second player's turn.
+				if (this->Game->AIEnabled()) { // It's the AI's turn.
+					if (this->CardsBusy()) { // Wait for the previous move, any key finishes its page swipe.
+						if (Down) this->Anims.CancelGroup((uint8_t)AnimGroup::Page, true);
+						return GameHelper::LogicState::Nothing;
+					}
+
+					return this->AILogic(Down);
+
+				} else return this->PlayerLogic(Down, Held, Repeat, G); // It's the second player's turn.
 			}
 
 		} else { // State -> DoCheck.
-			if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) { // Use the card delay.
-				if (this->RefreshFrame) {
-					this->RefreshFrame = false;
-					return GameHelper::LogicState::Nothing;
-				}
+			if (this->CardsBusy()) return GameHelper::LogicState::Nothing; // Wait until both cards are fully turned.
 
-				if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) {
-					for (uint8_t Idx = 0; Idx < this->Params.CardDelay; Idx++) { gspWaitForVBlank(); }; // Do the delay, if enabled.
-				}
+			if (this->Params.CardDelayUsed && this->Params.CardDelay > 0) { // Use the card delay.
+				if (!this->DelayDone(Down)) return GameHelper::LogicState::Nothing; // Do the delay.
 
-				const GameHelper::LogicState State = this->TurnChecks();
-				return State;
+				this->TurnChecks();
+				return GameHelper::LogicState::Nothing;
 
 			} else { // We don't have a valid card delay set, so handle through click.
 				if (Down) {
-					const GameHelper::LogicState State = this->TurnChecks();
-					return State;
+					this->TurnChecks();
+					return GameHelper::LogicState::Nothing;
 				}
 			}
 		}
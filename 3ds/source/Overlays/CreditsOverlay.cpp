@@ -26,11 +26,12 @@
 
 #include "Common.hpp"
 #include "CreditsOverlay.hpp"
+#include "Transition.hpp" // Fade-Out.
 
 
 /* Go to the previous Page. */
 void CreditsOverlay::PrevPage() {
-	if (this->Page > 0) {
+	if (this->Page > 0 && !this->Dragging) {
 		this->SwipeDirection = true;
 		this->DoSwipe = true;
 	}
@@ -39,13 +40,51 @@ void CreditsOverlay::PrevPage() {
 
 /* Go to the next Page. */
 void CreditsOverlay::NextPage() {
-	if (this->Page < 6) {
+	if (this->Page < 6 && !this->Dragging) {
 		this->SwipeDirection = false;
 		this->DoSwipe = true;
 	}
 }
 
 
+/* Moves the current page and the one in swipe direction by Cubic. */
+void CreditsOverlay::MovePages() {
+	this->CurPos = (this->SwipeDirection ? this->Cubic : 0 - this->Cubic);
+	this->PrevPos = -400 + (this->SwipeDirection ? this->Cubic : 0.0f); // -> (Last).
+	this->NextPos = 400 - (this->SwipeDirection ? 0.0f : this->Cubic); // <- (Next).
+}
+
+
+/*
+	Moves the pages with the finger. The drag on the touch screen is scaled to the wider top screen.
+
+	const float DX: The horizontal distance of the drag.
+*/
+void CreditsOverlay::DragPage(const float DX) {
+	this->SwipeDirection = (DX > 0.0f);
+	this->Dragging = (this->SwipeDirection ? this->Page > 0 : this->Page < 6); // Only, if there's a page on that side.
+
+	this->Cubic = (this->Dragging ? std::min(std::fabs(DX) * 1.25f, 400.0f) : 0.0f);
+	this->MovePages();
+	GFX::Invalidate();
+}
+
+
+/*
+	Lets the pages go after a drag.
+	A swipe or flick finishes the page switch from where the finger left it, otherwise the pages move back.
+
+	const bool Switch: If it should switch the page.
+*/
+void CreditsOverlay::DropPage(const bool Switch) {
+	if (!this->Dragging) return;
+
+	this->Dragging = false;
+	if (Switch) this->DoSwipe = true;
+	else this->SwipeBack = true;
+}
+
+
 /* Give an OK. */
 void CreditsOverlay::OK() { this->Done = true; }
 
@@ -59,134 +98,140 @@ void CreditsOverlay::OK() { this->Done = true; }
 void CreditsOverlay::DrawPage(const int16_t Pg, const int AddOffs) {
 	switch(Pg) {
 		case 0: // Contributors.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("CREDITS_CONTRIBUTORS"), 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_CONTRIBUTORS), 380);
 
-			Gui::DrawString(40 + AddOffs, 50, 0.5f, TEXT_WHITE, "devkitPro: ");
-			Gui::DrawStringCentered(0 + AddOffs, 70, 0.45f, TEXT_WHITE, "devkitARM, libctru, citro2d, citro3d.", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 50, 0.5f, TEXT_WHITE, "devkitPro: ");
+			GFX::DrawStringCentered(0 + AddOffs, 70, 0.45f, TEXT_WHITE, "devkitARM, libctru, citro2d, citro3d.", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "SuperSaiyajinStackZ: ");
-			Gui::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, Lang::Get("CREDITS_CONTRIBUTORS_SZ"), 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "SuperSaiyajinStackZ: ");
+			GFX::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_CONTRIBUTORS_SZ), 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 150, 0.5f, TEXT_WHITE, "Universal-Team: ");
-			Gui::DrawStringCentered(0 + AddOffs, 170, 0.45f, TEXT_WHITE, "Universal-Core.", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 150, 0.5f, TEXT_WHITE, "Universal-Team: ");
+			GFX::DrawStringCentered(0 + AddOffs, 170, 0.45f, TEXT_WHITE, "Universal-Core.", 300, 20, nullptr, C2D_WordWrap);
 			break;
 
 		case 1: // StackMem-Core.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, "StackMem-Core", 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, "StackMem-Core", 380);
 			Gui::DrawSprite(GFX::Sprites, sprites_stackmemcore_idx, 40 + AddOffs, 60);
 			break;
 
 		case 2: // Universal-Core.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, "Universal-Core", 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, "Universal-Core", 380);
 			Gui::DrawSprite(GFX::Sprites, sprites_universal_core_idx, 92 + AddOffs, 69);
 			break;
 
 		case 3: // Translators 1 / 3.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("CREDITS_TRANSLATORS") + " 1 / 3", 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_TRANSLATORS) + " 1 / 3", 380);
 
-			Gui::DrawString(40 + AddOffs, 60, 0.5f, TEXT_WHITE, "Bruh: ");
-			Gui::DrawStringCentered(0 + AddOffs, 80, 0.45f, TEXT_WHITE, "Dhalian", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 60, 0.5f, TEXT_WHITE, "Bruh: ");
+			GFX::DrawStringCentered(0 + AddOffs, 80, 0.45f, TEXT_WHITE, "Dhalian", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "Deutsch: ");
-			Gui::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, "Crafto1337, SuperSaiyajinStackZ", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "Deutsch: ");
+			GFX::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, "Crafto1337, SuperSaiyajinStackZ", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 140, 0.5f, TEXT_WHITE, "English: ");
-			Gui::DrawStringCentered(0 + AddOffs, 160, 0.45f, TEXT_WHITE, "Pk11, SuperSaiyajinStackZ", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 140, 0.5f, TEXT_WHITE, "English: ");
+			GFX::DrawStringCentered(0 + AddOffs, 160, 0.45f, TEXT_WHITE, "Pk11, SuperSaiyajinStackZ", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 180, 0.5f, TEXT_WHITE, "Español: ");
-			//Gui::DrawStringCentered(0 + AddOffs, 200, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 180, 0.5f, TEXT_WHITE, "Español: ");
+			//GFX::DrawStringCentered(0 + AddOffs, 200, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
 			break;
 
 		case 4: // Translators 2 / 3.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("CREDITS_TRANSLATORS") + " 2 / 3", 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_TRANSLATORS) + " 2 / 3", 380);
 
-			Gui::DrawString(40 + AddOffs, 60, 0.5f, TEXT_WHITE, "Français: ");
-			Gui::DrawStringCentered(0 + AddOffs, 80, 0.45f, TEXT_WHITE, "LinuxCat", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 60, 0.5f, TEXT_WHITE, "Français: ");
+			GFX::DrawStringCentered(0 + AddOffs, 80, 0.45f, TEXT_WHITE, "LinuxCat", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "Italiano: ");
-			//Gui::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "Italiano: ");
+			//GFX::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 140, 0.5f, TEXT_WHITE, "Polski: ");
-			//Gui::DrawStringCentered(0 + AddOffs, 160, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 140, 0.5f, TEXT_WHITE, "Polski: ");
+			//GFX::DrawStringCentered(0 + AddOffs, 160, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 180, 0.5f, TEXT_WHITE, "Português: ");
-			//Gui::DrawStringCentered(0 + AddOffs, 200, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 180, 0.5f, TEXT_WHITE, "Português: ");
+			//GFX::DrawStringCentered(0 + AddOffs, 200, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
 			break;
 
 		case 5: // Translators 3 / 3.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("CREDITS_TRANSLATORS") + " 3 / 3", 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_TRANSLATORS) + " 3 / 3", 380);
 
-			Gui::DrawString(40 + AddOffs, 60, 0.5f, TEXT_WHITE, "Русский: ");
-			//Gui::DrawStringCentered(0 + AddOffs, 80, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 60, 0.5f, TEXT_WHITE, "Русский: ");
+			//GFX::DrawStringCentered(0 + AddOffs, 80, 0.45f, TEXT_WHITE, "", 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "日本語: ");
-			Gui::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, "Pk11", 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "日本語: ");
+			GFX::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, "Pk11", 300, 20, nullptr, C2D_WordWrap);
 			break;
 
 		case 6: // Special Thanks.
-			Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("CREDITS_SPECIAL_THANKS"), 380);
+			GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_SPECIAL_THANKS), 380);
 
-			Gui::DrawString(40 + AddOffs, 40, 0.5f, TEXT_WHITE, "NightScript: ");
-			Gui::DrawStringCentered(0 + AddOffs, 60, 0.45f, TEXT_WHITE, Lang::Get("CREDITS_SPECIAL_THANKS_NS"), 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 40, 0.5f, TEXT_WHITE, "NightScript: ");
+			GFX::DrawStringCentered(0 + AddOffs, 60, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_SPECIAL_THANKS_NS), 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "Pk11: ");
-			Gui::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, Lang::Get("CREDITS_SPECIAL_THANKS_PK11"), 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 100, 0.5f, TEXT_WHITE, "Pk11: ");
+			GFX::DrawStringCentered(0 + AddOffs, 120, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_SPECIAL_THANKS_PK11), 300, 20, nullptr, C2D_WordWrap);
 
-			Gui::DrawString(40 + AddOffs, 160, 0.5f, TEXT_WHITE, "Universal-Microwave: ");
-			Gui::DrawStringCentered(0 + AddOffs, 180, 0.45f, TEXT_WHITE, Lang::Get("CREDITS_SPECIAL_THANKS_UM"), 300, 20, nullptr, C2D_WordWrap);
+			GFX::DrawString(40 + AddOffs, 160, 0.5f, TEXT_WHITE, "Universal-Microwave: ");
+			GFX::DrawStringCentered(0 + AddOffs, 180, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::CREDITS_SPECIAL_THANKS_UM), 300, 20, nullptr, C2D_WordWrap);
 	}
 }
 
 
-/* Main Action. */
-void CreditsOverlay::Action() {
-	Pointer::OnTop = true;
-	Pointer::SetPos(0, 0);
+/* Draws both screens, with the fade. */
+void CreditsOverlay::Draw() {
+	GFX::DrawTop();
+	/* Draw Content. */
+	if (this->DoSwipe || this->InitialSwipe || this->Dragging || this->SwipeBack) { // We swipe.
+		this->DrawPage(this->Page, this->CurPos); // Draw current page.
+
+		if (this->SwipeDirection) this->DrawPage(this->Page - 1, this->PrevPos);
+		else this->DrawPage(this->Page + 1, this->NextPos);
 
-	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+	} else { // No swipe.
+		this->DrawPage(this->Page, 0); // Draw current page only.
+	}
 
-		GFX::DrawTop();
-		/* Draw Content. */
-		if (this->DoSwipe || this->InitialSwipe) { // We swipe.
-			this->DrawPage(this->Page, this->CurPos); // Draw current page.
+	GFX::DrawCornerEdge(true, this->Positions[0].X, this->Positions[0].Y, this->Positions[0].H, this->Page > 0);
+	GFX::DrawCornerEdge(false, this->Positions[1].X, this->Positions[1].Y, this->Positions[1].H, this->Page < 6);
+	Pointer::Draw();
 
-			if (this->SwipeDirection) this->DrawPage(this->Page - 1, this->PrevPos);
-			else this->DrawPage(this->Page + 1, this->NextPos);
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
 
-		} else { // No swipe.
-			this->DrawPage(this->Page, 0); // Draw current page only.
-		}
+	/* Bottom. */
+	GFX::DrawBottom();
+	Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
+	GFX::DrawCornerEdge(true, this->BottomPos[0].X, this->BottomPos[0].Y, this->BottomPos[0].H, this->Page > 0);
+	GFX::DrawCornerEdge(false, this->BottomPos[2].X, this->BottomPos[2].Y, this->BottomPos[2].H, this->Page < 6);
 
-		GFX::DrawCornerEdge(true, this->Positions[0].X, this->Positions[0].Y, this->Positions[0].H, this->Page > 0);
-		GFX::DrawCornerEdge(false, this->Positions[1].X, this->Positions[1].Y, this->Positions[1].H, this->Page < 6);
-		Pointer::Draw();
+	Gui::Draw_Rect(95, 105, 130, 30, BAR_BLUE);
+	Gui::Draw_Rect(this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].W, this->BottomPos[1].H, BG_BLUE);
+	GFX::DrawStringCentered(0, this->BottomPos[1].Y + 3, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::OK));
+
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
+}
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-		}
 
-		/* Bottom. */
-		GFX::DrawBottom();
-		Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
-		GFX::DrawCornerEdge(true, this->BottomPos[0].X, this->BottomPos[0].Y, this->BottomPos[0].H, this->Page > 0);
-		GFX::DrawCornerEdge(false, this->BottomPos[2].X, this->BottomPos[2].Y, this->BottomPos[2].H, this->Page < 6);
+/* Main Action. */
+void CreditsOverlay::Action() {
+	GFX::Invalidate(); // A new screen is shown.
 
-		Gui::Draw_Rect(95, 105, 130, 30, BAR_BLUE);
-		Gui::Draw_Rect(this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].W, this->BottomPos[1].H, BG_BLUE);
-		Gui::DrawStringCentered(0, this->BottomPos[1].Y + 3, 0.5f, TEXT_WHITE, Lang::Get("OK"));
+	Pointer::OnTop = true;
+	Pointer::SetPos(0, 0);
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw();
+			GFX::EndFrame();
 		}
 
-		C3D_FrameEnd(0);
 		this->Handler();
 	}
 
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(); }, true);
 	Pointer::OnTop = false;
 	Pointer::SetPos(0, 0);
 }
@@ -194,35 +239,24 @@ void CreditsOverlay::Action() {
 
 /* Action Handler. */
 void CreditsOverlay::Handler() {
-	hidScanInput();
+	Input::Scan();
 	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Down = hidKeysDown();
-	const uint32_t Held = hidKeysHeld();
-	const uint32_t Repeat = hidKeysDownRepeat();
+	Input::TouchRead(&T);
+	const uint32_t Down = Input::Down();
+	const uint32_t Held = Input::Held();
+	const uint32_t Repeat = Input::Repeat();
 
 	/* Fade-In Handler. */
 	if (this->FadeIn) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0, this->FadeIn = false;
 
 		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
+			this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 			if (this->FAlpha <= 0) this->FadeIn = false;
 		}
 	}
 
-	/* Fade-Out Handler. */
-	if (this->Done) {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FullDone = true;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FullDone = true;
-		}
-	}
-
 	/* Initial Swipe. */
 	if (this->InitialSwipe) {
 		if (!_3DZwei::CFG->DoAnimation()) {
@@ -232,7 +266,7 @@ void CreditsOverlay::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 			this->CurPos = -400 + this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -248,6 +282,8 @@ void CreditsOverlay::Handler() {
 	/* Swipe Logic. */
 	if (this->DoSwipe) {
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
+			if (Repeat & KEY_TOUCH) this->Touch.Cancel(); // The touch only skipped the swipe.
+
 			this->CurPos = 0.0f, this->PrevPos = -400.0f, this->NextPos = 400.0f;
 			this->Cubic = 0.0f;
 			this->DoSwipe = false;
@@ -257,16 +293,8 @@ void CreditsOverlay::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
-
-			if (this->SwipeDirection) { // -> (Last).
-				this->CurPos = this->Cubic;
-				this->PrevPos = -400 + this->Cubic;
-
-			} else { // <- (Next).
-				this->CurPos = 0 - this->Cubic;
-				this->NextPos = 400 - this->Cubic;
-			}
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
+			this->MovePages();
 
 			if (this->Cubic >= 400.0f) {
 				this->CurPos = 0.0f, this->PrevPos = -400.0f, this->NextPos = 400.0f;
@@ -280,20 +308,41 @@ void CreditsOverlay::Handler() {
 		return;
 	}
 
+	/* Page Move Back after a drag. */
+	if (this->SwipeBack) {
+		this->Cubic = Clock::Lerp(this->Cubic, -1.0f, 0.3f);
+		if (!_3DZwei::CFG->DoAnimation() || this->Cubic <= 0.0f) this->Cubic = 0.0f, this->SwipeBack = false;
+
+		this->MovePages();
+		return;
+	}
+
 	Pointer::ScrollHandling(Held);
 	if (Repeat & KEY_L) this->PrevPage();
 	if (Repeat & KEY_R) this->NextPage();
 
-	if (Repeat & KEY_A) {
-		for (auto &Position : this->Positions) {
-			if (Pointer::Clicked(Position, true)) break;
-		}
-	}
+	if (Repeat & KEY_A) this->PositionsIndex.Clicked();
 
-	if (Repeat & KEY_TOUCH) {
-		for (auto &Position : this->BottomPos) {
-			if (Touched(Position, T, true)) break;
-		}
+	switch(this->Touch.Update(Held, T)) {
+		case Gesture::Type::Press: // None of the buttons are on a page, so they don't wait for a tap.
+			if (this->BottomPosIndex.Touched(T)) this->Touch.Cancel();
+			break;
+
+		case Gesture::Type::Drag:
+			this->DragPage(this->Touch.DX());
+			break;
+
+		case Gesture::Type::Swipe:
+		case Gesture::Type::Flick:
+			this->DropPage(true);
+			break;
+
+		case Gesture::Type::Release:
+			this->DropPage(false);
+			break;
+
+		default:
+			break;
 	}
 
 	if (Down & KEY_START || Down & KEY_B) this->OK(); // Exit with START or B as well.
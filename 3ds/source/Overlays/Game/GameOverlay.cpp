@@ -28,54 +28,91 @@
 #include "GameOverlay.hpp"
 #include "GameResult.hpp"
 
+#define LOGIC_STEP  (SYSCLOCK_ARM11 / 60) // The logic runs at 60 FPS.
+#define LOGIC_STACK 0x10000 // The AI and the statistics need some stack.
+
 
 /* Initialize with the Game Parameters. */
 GameOverlay::GameOverlay(const GameSettings::GameParams Params) {
 	this->Helper = std::make_unique<GameHelper>(Params);
-	hidScanInput();
+	Input::Scan();
 }
 
 
+/*
+	Draws the latest frame snapshot of the logic. Nothing gets drawn, if there is no newer one.
+*/
 void GameOverlay::Draw() {
-	Gui::clearTextBufs();
-	C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-	C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+	const bool Fresh = this->Frames.Acquire();
+	const Frame &F = this->Frames.Front();
+
+	if (F.PromptHandle && !this->Snap) { // The prompt opened.
+		this->Snap = std::make_unique<Transition>();
+		this->Snap->Capture([this, &F]() {
+			this->Helper->DrawTop(F.Game);
+			this->Helper->DrawField(F.Game);
+		});
+
+	} else if (!F.PromptHandle && this->Snap) { // The prompt is closed.
+		this->Snap = nullptr;
+	}
 
-	this->Helper->DrawTop();
-	if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha)); // Dimming.
-	this->Helper->DrawField();
-	if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha)); // Dimming.
+	if (!GFX::BeginFrame(Fresh)) return; // Nothing changed.
 
-	if (this->PromptHandle && !this->PromptAnswer) {
-		if (this->SwipeIn) {
-			Gui::DrawStringCentered(0, 80 + 190 - this->FAlpha, 0.6f, TEXT_WHITE, Lang::Get("EXIT_GAME"));
+	if (this->Snap && this->Snap->Captured()) this->Snap->DrawTop();
+	else this->Helper->DrawTop(F.Game);
+	if (F.FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, F.FAlpha)); // Dimming.
 
-		} else if (this->SwipeOut) {
-			Gui::DrawStringCentered(0, 80 + 190 - this->FAlpha, 0.6f, TEXT_WHITE, Lang::Get("EXIT_GAME"));
+	if (this->Snap && this->Snap->Captured()) this->Snap->DrawBottom();
+	else this->Helper->DrawField(F.Game);
+	if (F.FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, F.FAlpha)); // Dimming.
+
+	if (F.PromptHandle && !F.PromptAnswer) {
+		if (F.SwipeIn) {
+			GFX::DrawStringCentered(0, 80 + 190 - F.FAlpha, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::EXIT_GAME));
+
+		} else if (F.SwipeOut) {
+			GFX::DrawStringCentered(0, 80 + 190 - F.FAlpha, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::EXIT_GAME));
 
 		} else {
-			Gui::DrawStringCentered(0, 80, 0.6f, TEXT_WHITE, Lang::Get("EXIT_GAME"));
+			GFX::DrawStringCentered(0, 80, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::EXIT_GAME));
 		}
 
 		/* Draw Prompt buttons. */
 		for (size_t Idx = 0; Idx < 2; Idx++) {
-			if (this->SwipeIn) {
-				Gui::Draw_Rect(this->Prompt[Idx].X, this->Prompt[Idx].Y + 190 - this->FAlpha, this->Prompt[Idx].W, this->Prompt[Idx].H, BAR_BLUE);
-				Gui::DrawStringCentered(this->Prompt[Idx].X - 160 + this->Prompt[Idx].W / 2, this->Prompt[Idx].Y + 15 + 190 - this->FAlpha, 0.6f, TEXT_WHITE, (Idx == 0 ? "\uE001 " : "\uE000 ") + Lang::Get((Idx == 0 ? "CANCEL" : "CONFIRM")), this->Prompt[Idx].W - 10);
+			if (F.SwipeIn) {
+				Gui::Draw_Rect(this->Prompt[Idx].X, this->Prompt[Idx].Y + 190 - F.FAlpha, this->Prompt[Idx].W, this->Prompt[Idx].H, BAR_BLUE);
+				GFX::DrawStringCentered(this->Prompt[Idx].X - 160 + this->Prompt[Idx].W / 2, this->Prompt[Idx].Y + 15 + 190 - F.FAlpha, 0.6f, TEXT_WHITE, (Idx == 0 ? "\uE001 " : "\uE000 ") + Lang::Get((Idx == 0 ? Lang::Str::CANCEL : Lang::Str::CONFIRM)), this->Prompt[Idx].W - 10);
 
-			} else if (this->SwipeOut) {
-				Gui::Draw_Rect(this->Prompt[Idx].X, this->Prompt[Idx].Y + 190 - this->FAlpha, this->Prompt[Idx].W, this->Prompt[Idx].H, BAR_BLUE);
-				Gui::DrawStringCentered(this->Prompt[Idx].X - 160 + this->Prompt[Idx].W / 2, this->Prompt[Idx].Y + 15 + 190 - this->FAlpha, 0.6f, TEXT_WHITE, (Idx == 0 ? "\uE001 " : "\uE000 ") + Lang::Get((Idx == 0 ? "CANCEL" : "CONFIRM")), this->Prompt[Idx].W - 10);
+			} else if (F.SwipeOut) {
+				Gui::Draw_Rect(this->Prompt[Idx].X, this->Prompt[Idx].Y + 190 - F.FAlpha, this->Prompt[Idx].W, this->Prompt[Idx].H, BAR_BLUE);
+				GFX::DrawStringCentered(this->Prompt[Idx].X - 160 + this->Prompt[Idx].W / 2, this->Prompt[Idx].Y + 15 + 190 - F.FAlpha, 0.6f, TEXT_WHITE, (Idx == 0 ? "\uE001 " : "\uE000 ") + Lang::Get((Idx == 0 ? Lang::Str::CANCEL : Lang::Str::CONFIRM)), this->Prompt[Idx].W - 10);
 
 			} else {
 				Gui::Draw_Rect(this->Prompt[Idx].X, this->Prompt[Idx].Y, this->Prompt[Idx].W, this->Prompt[Idx].H, BAR_BLUE);
-				Gui::DrawStringCentered(this->Prompt[Idx].X - 160 + this->Prompt[Idx].W / 2, this->Prompt[Idx].Y + 15, 0.6f, TEXT_WHITE, (Idx == 0 ? "\uE001 " : "\uE000 ") + Lang::Get((Idx == 0 ? "CANCEL" : "CONFIRM")), this->Prompt[Idx].W - 10);
+				GFX::DrawStringCentered(this->Prompt[Idx].X - 160 + this->Prompt[Idx].W / 2, this->Prompt[Idx].Y + 15, 0.6f, TEXT_WHITE, (Idx == 0 ? "\uE001 " : "\uE000 ") + Lang::Get((Idx == 0 ? Lang::Str::CANCEL : Lang::Str::CONFIRM)), this->Prompt[Idx].W - 10);
 			}
 		}
 	}
 
-	C3D_FrameEnd(0);
+	GFX::EndFrame();
+
+	if (F.Game.MarkID != this->ShownMark) { // The change of a press is on the screen now.
+		this->ShownMark = F.Game.MarkID;
+		Input::Presented(F.Game.MarkTag, F.Game.MarkFrame);
+	}
+}
+
+
+/* Copies the current state into the next frame snapshot and publishes it for the drawing. */
+void GameOverlay::Publish() {
+	Frame &F = this->Frames.Back();
+
+	this->Helper->Publish(F.Game);
+	F.FAlpha = this->FAlpha;
+	F.PromptHandle = this->PromptHandle, F.PromptAnswer = this->PromptAnswer;
+	F.SwipeIn = this->SwipeIn, F.SwipeOut = this->SwipeOut;
+	this->Frames.Publish();
 }
 
 
@@ -87,16 +124,15 @@ void GameOverlay::Cancel() {
 
 /* Prompt logic. */
 void GameOverlay::PromptLogic() {
-	hidScanInput();
-	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Down = hidKeysDown();
+	Input::Scan();
+	Input::Event E = { };
+	if (!this->SwipeIn && !this->SwipeOut) Input::Poll(E); // Presses during the swipes stay queued for the prompt or the game.
 
 	if (this->SwipeIn) {
 		if (!_3DZwei::CFG->DoAnimation()) this->FAlpha = 0, this->SwipeIn = false;
 		else {
 			if (this->Cubic < 190.0f) {
-				this->Cubic = std::lerp(this->Cubic, 191.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 191.0f, 0.1f);
 				this->FAlpha = this->Cubic;
 
 				if (this->Cubic >= 190.0f) {
@@ -113,7 +149,7 @@ void GameOverlay::PromptLogic() {
 			if (!_3DZwei::CFG->DoAnimation()) this->FAlpha = 255, this->SwipeOut = false, this->Running = false;
 			else {
 				if (this->Cubic < 60.0f) {
-					this->Cubic = std::lerp(this->Cubic, 61.0f, 0.1f);
+					this->Cubic = Clock::Lerp(this->Cubic, 61.0f, 0.1f);
 					this->FAlpha = 190 + this->Cubic;
 
 					if (this->Cubic >= 60.0f) {
@@ -126,7 +162,7 @@ void GameOverlay::PromptLogic() {
 			if (!_3DZwei::CFG->DoAnimation()) this->FAlpha = 0, this->SwipeOut = false, this->PromptAnswer = false;
 			else {
 				if (this->Cubic < 190.0f) {
-					this->Cubic = std::lerp(this->Cubic, 191.0f, 0.1f);
+					this->Cubic = Clock::Lerp(this->Cubic, 191.0f, 0.1f);
 					this->FAlpha = (190 - this->Cubic);
 
 					if (this->Cubic >= 190.0f) {
@@ -139,71 +175,156 @@ void GameOverlay::PromptLogic() {
 		return;
 	}
 
-	if (Down & KEY_A) this->Confirm();
-	if (Down & KEY_B) this->Cancel();
+	if (E.Down & KEY_A) this->Confirm();
+	if (E.Down & KEY_B) this->Cancel();
 
-	if (Down & KEY_TOUCH) {
-		for (auto Pos : this->Prompt) {
-			if (Touched(Pos, T, true)) break;
+	if (E.Down & KEY_TOUCH) this->PromptIndex.Touched(E.Touch);
+}
+
+
+/*
+	One step of the game logic. A new frame snapshot is only published, if the screens changed.
+	Returns false, once the round ended or the game got exited.
+*/
+bool GameOverlay::Step() {
+	this->Helper->Tick(); // Advance the game animations.
+
+	if (this->PromptHandle) this->PromptLogic();
+	else {
+		if (this->PromptAnswer) this->Running = false;
+		Input::Scan();
+
+		/* Presses are taken from the queue, once the game can handle them. So a press during a card animation isn't lost. */
+		Input::Event E = { };
+		if (this->Helper->WantsInput()) Input::Poll(E);
+
+		/* Logic. The gestures need the live touch of every frame, not the one of the queued press. */
+		touchPosition T;
+		Input::TouchRead(&T);
+		this->Result = this->Helper->Logic(E.Down, Input::Held(), E.Repeat, T, E.Frame);
+
+		if (this->Helper->ReturnParams().CancelGame) {
+			this->PromptHandle = true;
+			this->SwipeIn = true;
 		}
 	}
+
+	if (GFX::Changed()) this->Publish();
+	return (this->Running && this->Result == GameHelper::LogicState::Nothing);
 }
 
 
-void GameOverlay::Action() {
-	while(aptMainLoop() && this->Running) {
+/*
+	The logic thread. It runs the logic steps at 60 FPS until the round ended or the game got exited.
+
+	void *Arg: The GameOverlay.
+*/
+void GameOverlay::LogicLoop(void *Arg) {
+	GameOverlay *Ovl = (GameOverlay *)Arg;
+	uint64_t Next = svcGetSystemTick();
+
+	while(Ovl->Running) {
+		if (aptIsActive() && !Ovl->Step()) break; // The game pauses, while the Home Menu is shown.
+
+		/* Wait for the next step. If it's already late, like after a slow AI move, it just goes on from now. */
+		const uint64_t Now = svcGetSystemTick();
+		Next += LOGIC_STEP;
+
+		if (Now < Next) svcSleepThread((Next - Now) * 1000000000ULL / SYSCLOCK_ARM11);
+		else Next = Now;
+	}
+
+	Ovl->LogicActive = false;
+}
+
+
+/*
+	Starts the logic thread. The New 3DS has an extra core for it, otherwise it shares the core with the drawing.
+	Returns nullptr, if no thread could be created.
+*/
+Thread GameOverlay::StartLogic() {
+	bool New3DS = false;
+	APT_CheckNew3DS(&New3DS);
+
+	s32 Prio = 0x30;
+	svcGetThreadPriority(&Prio, CUR_THREAD_HANDLE);
+
+	Thread Logic = nullptr;
+	if (New3DS) Logic = threadCreate(GameOverlay::LogicLoop, this, LOGIC_STACK, Prio - 1, 2, false);
+	if (!Logic) Logic = threadCreate(GameOverlay::LogicLoop, this, LOGIC_STACK, Prio - 1, -2, false); // The core of the app.
+	return Logic;
+}
+
+
+/*
+	Plays until the round ended or the game got exited.
+	This thread only draws, while the logic runs on its own thread. If there is none, the logic runs here after drawing.
+*/
+void GameOverlay::Play() {
+	GFX::Invalidate(); // A new screen is shown.
+	Input::Flush(); // Presses of the previous screen don't belong to the game.
+	Input::Queue(true); // The game takes its presses, once it can handle them.
+	this->LogicActive = true;
+	const Thread Logic = this->StartLogic();
+
+	while(this->LogicActive) {
+		if (!aptMainLoop()) {
+			this->Running = false; // The logic thread stops as well.
+			break;
+		}
+
+		if (!Logic) this->LogicActive = this->Step();
 		this->Draw();
+	}
 
-		if (this->PromptHandle) this->PromptLogic();
-		else {
-			if (this->PromptAnswer) this->Running = false;
-			hidScanInput();
-			touchPosition T;
-			hidTouchRead(&T);
-			const uint32_t Down = hidKeysDown();
-			const uint32_t Held = hidKeysHeld();
-			const uint32_t Repeat = hidKeysDownRepeat();
-
-			/* Logic. */
-			const GameHelper::LogicState State = this->Helper->Logic(Down, Held, Repeat, T);
-			if (State != GameHelper::LogicState::Nothing) { // Someone won already.
-				std::unique_ptr<GameResult> Ovl = std::make_unique<GameResult>();
-
-				/* Get the proper Overlay. They also set the win count to ++ for the winner. */
-				switch(State) {
-					case GameHelper::LogicState::Tie:
-						Ovl->Action(this->Helper->ReturnParams(), 0);
-						break;
-
-					case GameHelper::LogicState::P1Won:
-						Ovl->Action(this->Helper->ReturnParams(), 1);
-						break;
-
-					case GameHelper::LogicState::P2Won:
-						Ovl->Action(this->Helper->ReturnParams(), 2);
-						break;
-
-					case GameHelper::LogicState::Nothing:
-						break; // Should never happen.
-				}
+	if (Logic) {
+		threadJoin(Logic, U64_MAX);
+		threadFree(Logic);
+	}
+
+	Input::Queue(false); // The next screens handle their presses directly.
+}
 
-				/* If we reached the needed win amount, are on Solo Mode -> go the screen back to the MainMenu again. */
-				if ((this->Helper->ReturnParams().Wins[0] >= this->Helper->ReturnParams().RoundsToWin)
-				|| (this->Helper->ReturnParams().Wins[1] >= this->Helper->ReturnParams().RoundsToWin)
-				|| (this->Helper->ReturnParams().GameMode == GameSettings::GameModes::Solo)) {
-					this->Running = false; // Game is not running anymore.
-					return;
 
-				} else {
-					this->Helper->StartGame(true, { }, State == GameHelper::LogicState::P2Won);
-					hidScanInput();
-				}
-			}
+void GameOverlay::Action() {
+	while(this->Running) {
+		this->Play();
 
-			if (this->Helper->ReturnParams().CancelGame) {
-				this->PromptHandle = true;
-				this->SwipeIn = true;
-			}
+		const GameHelper::LogicState State = this->Result;
+		if (State == GameHelper::LogicState::Nothing || !this->Running) break; // The game got exited.
+		this->Result = GameHelper::LogicState::Nothing;
+
+		/* Someone won already. */
+		std::unique_ptr<GameResult> Ovl = std::make_unique<GameResult>();
+
+		/* Get the proper Overlay. They also set the win count to ++ for the winner. */
+		switch(State) {
+			case GameHelper::LogicState::Tie:
+				Ovl->Action(this->Helper->ReturnParams(), 0);
+				break;
+
+			case GameHelper::LogicState::P1Won:
+				Ovl->Action(this->Helper->ReturnParams(), 1);
+				break;
+
+			case GameHelper::LogicState::P2Won:
+				Ovl->Action(this->Helper->ReturnParams(), 2);
+				break;
+
+			case GameHelper::LogicState::Nothing:
+				break; // Should never happen.
+		}
+
+		/* If we reached the needed win amount, are on Solo Mode -> go the screen back to the MainMenu again. */
+		if ((this->Helper->ReturnParams().Wins[0] >= this->Helper->ReturnParams().RoundsToWin)
+		|| (this->Helper->ReturnParams().Wins[1] >= this->Helper->ReturnParams().RoundsToWin)
+		|| (this->Helper->ReturnParams().GameMode == GameSettings::GameModes::Solo)) {
+			this->Running = false; // Game is not running anymore.
+			return;
+
+		} else {
+			this->Helper->StartGame(true, { }, State == GameHelper::LogicState::P2Won);
+			Input::Scan();
 		}
 	}
-}
\ No newline at end of file
+}
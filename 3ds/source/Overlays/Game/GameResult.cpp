@@ -28,8 +28,13 @@
 #include "GameResult.hpp"
 #include "Utils.hpp"
 
+#define CONFETTI_AMOUNT 96
+static const uint32_t ConfettiColors[] = { C2D_Color32(255, 210, 60, 255), C2D_Color32(240, 90, 90, 255), C2D_Color32(90, 200, 120, 255), TEXT_WHITE };
+
 
 GameResult::GameResult() {
+	this->CardGrid.Resize(Utils::Cards.size());
+
 	if (!_3DZwei::CFG->DoAnimation()) {
 		this->DoSwipe = false, this->Delay = 0;
 		this->InitialScroll = false, this->ScrollIdx = 0; // No animation.
@@ -44,9 +49,10 @@ GameResult::GameResult() {
 	const int AddOffs: The additional offsets to draw to.
 */
 void GameResult::DrawCardBG(const size_t Page, const int AddOffs) {
-	for (size_t Idx = (Page * 12), Idx2 = 0; Idx < (Page * 12) + 12 && Idx < Utils::Cards.size(); Idx++, Idx2++) {
-		GFX::DrawCard(Idx, this->InitialScrollPos[Idx2].X, this->InitialScrollPos[Idx2].Y + AddOffs);
-	}
+	this->CardGrid.Draw(Page, 0, AddOffs, [this](const size_t Idx, const size_t Slot, const float X, const float Y) {
+		if (Idx < Utils::Cards.size()) this->Batch.Add(Utils::Cards[Idx], X, Y);
+	});
+	this->Batch.Draw();
 }
 
 
@@ -59,8 +65,8 @@ void GameResult::DrawCardBG(const size_t Page, const int AddOffs) {
 void GameResult::DrawOver(const bool P2Wins, const GameSettings::GameParams &Params) {
 	float topDelay = this->Delay * 1.1f; // Speed up delay on top so character makes it off screen.
 
-	char Buffer[100]; snprintf(Buffer, sizeof(Buffer), Lang::Get("WON").c_str(), Params.Names[P2Wins].c_str());
-	Gui::DrawStringCentered(0 + topDelay, 28, 0.6f, TEXT_WHITE, Buffer, 380);
+	char Buffer[100]; snprintf(Buffer, sizeof(Buffer), Lang::Get(Lang::Str::WON).c_str(), Params.Names[P2Wins].c_str());
+	GFX::DrawStringCentered(0 + topDelay, 28, 0.6f, TEXT_WHITE, Buffer, 380);
 
 	/* Draw Winner. */
 	if (Params.Characters[P2Wins] < Utils::GetCharSheetSize()) {
@@ -71,17 +77,18 @@ void GameResult::DrawOver(const bool P2Wins, const GameSettings::GameParams &Par
 
 		/* Name bar. */
 		Gui::Draw_Rect(148 + topDelay, 180, 106, 20, BAR_BLUE);
-		Gui::DrawString(151 + topDelay, 183, 0.45f, TEXT_WHITE, Params.Names[P2Wins], 100);
+		GFX::DrawString(151 + topDelay, 183, 0.45f, TEXT_WHITE, Params.Names[P2Wins], 100);
 
 		/* Wins. */
-		Gui::DrawString(148 + topDelay, 205, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(Params.PlayerPairs[P2Wins]), 200);
-		Gui::DrawString(148 + topDelay, 225, 0.45f, TEXT_WHITE, Lang::Get("WINS") + std::to_string(Params.Wins[P2Wins]), 200);
+		GFX::DrawString(148 + topDelay, 205, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(Params.PlayerPairs[P2Wins]), 200);
+		GFX::DrawString(148 + topDelay, 225, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::WINS) + std::to_string(Params.Wins[P2Wins]), 200);
 	}
 
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
 		if (this->Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->Delay));
 	}
 
+	this->Confetti.Draw();
 	GFX::DrawBottom();
 
 	/* Draw Loser. */
@@ -91,11 +98,11 @@ void GameResult::DrawOver(const bool P2Wins, const GameSettings::GameParams &Par
 
 		/* Name bar. */
 		Gui::Draw_Rect(103 - this->Delay, 160, 106, 20, BAR_BLUE);
-		Gui::DrawString(107 - this->Delay, 163, 0.45f, TEXT_WHITE, Params.Names[!P2Wins], 100);
+		GFX::DrawString(107 - this->Delay, 163, 0.45f, TEXT_WHITE, Params.Names[!P2Wins], 100);
 
 		/* Wins. */
-		Gui::DrawString(103 - this->Delay, 185, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(Params.PlayerPairs[!P2Wins]), 150);
-		Gui::DrawString(103 - this->Delay, 205, 0.45f, TEXT_WHITE, Lang::Get("WINS") + std::to_string(Params.Wins[!P2Wins]), 150);
+		GFX::DrawString(103 - this->Delay, 185, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(Params.PlayerPairs[!P2Wins]), 150);
+		GFX::DrawString(103 - this->Delay, 205, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::WINS) + std::to_string(Params.Wins[!P2Wins]), 150);
 	}
 
 	Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190));
@@ -123,17 +130,18 @@ void GameResult::DrawVersus(const bool P2Wins, const GameSettings::GameParams &P
 
 		/* Name bar. */
 		Gui::Draw_Rect(148 + topDelay, 180, 106, 20, BAR_BLUE);
-		Gui::DrawString(151 + topDelay, 183, 0.45f, TEXT_WHITE, Params.Names[P2Wins], 100);
+		GFX::DrawString(151 + topDelay, 183, 0.45f, TEXT_WHITE, Params.Names[P2Wins], 100);
 
 		/* Wins. */
-		Gui::DrawString(148 + topDelay, 205, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(Params.PlayerPairs[P2Wins]), 200);
-		Gui::DrawString(148 + topDelay, 225, 0.45f, TEXT_WHITE, Lang::Get("WINS") + std::to_string(Params.Wins[P2Wins]), 200);
+		GFX::DrawString(148 + topDelay, 205, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(Params.PlayerPairs[P2Wins]), 200);
+		GFX::DrawString(148 + topDelay, 225, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::WINS) + std::to_string(Params.Wins[P2Wins]), 200);
 	}
 
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
 		if (this->Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->Delay));
 	}
 
+	this->Confetti.Draw();
 	GFX::DrawBottom();
 
 	/* Draw Loser. */
@@ -150,13 +158,13 @@ void GameResult::DrawVersus(const bool P2Wins, const GameSettings::GameParams &P
 
 		/* Name bar. */
 		Gui::Draw_Rect(103 - this->Delay, 150, 106, 20, BAR_BLUE);
-		Gui::DrawString(107 - this->Delay, 153, 0.45f, TEXT_WHITE, Params.Names[!P2Wins], 100);
+		GFX::DrawString(107 - this->Delay, 153, 0.45f, TEXT_WHITE, Params.Names[!P2Wins], 100);
 
 		/* Wins. */
-		Gui::DrawString(103 - this->Delay, 175, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(Params.PlayerPairs[!P2Wins]), 150);
-		Gui::DrawString(103 - this->Delay, 195, 0.45f, TEXT_WHITE, Lang::Get("WINS") + std::to_string(Params.Wins[!P2Wins]), 150);
+		GFX::DrawString(103 - this->Delay, 175, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(Params.PlayerPairs[!P2Wins]), 150);
+		GFX::DrawString(103 - this->Delay, 195, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::WINS) + std::to_string(Params.Wins[!P2Wins]), 150);
 
-		Gui::DrawStringCentered(0 + this->Delay, 215, 0.5f, TEXT_WHITE, Lang::Get("WINS_WIN") + std::to_string(Params.RoundsToWin), 310);
+		GFX::DrawStringCentered(0 + this->Delay, 215, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::WINS_WIN) + std::to_string(Params.RoundsToWin), 310);
 	}
 
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
@@ -175,12 +183,12 @@ void GameResult::DrawSolo(const GameSettings::GameParams &Params) {
 		Gui::DrawSprite(GFX::Characters, Params.Characters[0], 30 - this->Delay, 30);
 		Gui::DrawSprite(GFX::Sprites, sprites_outline_idx, 28 - this->Delay, 28);
 		Gui::Draw_Rect(37 - this->Delay, 159, 106, 20, BAR_BLUE);
-		Gui::DrawString(40 - this->Delay, 162, 0.45f, TEXT_WHITE, Params.Names[0], 100);
+		GFX::DrawString(40 - this->Delay, 162, 0.45f, TEXT_WHITE, Params.Names[0], 100);
 	}
 
-	Gui::DrawString(220, 80 - this->Delay, 0.45f, TEXT_WHITE, Lang::Get("PAIRS") + std::to_string(Params.PlayerPairs[0]), 150);
-	Gui::DrawString(220, 100 + this->Delay, 0.45f, TEXT_WHITE, Lang::Get("YOUR_TRIES") + std::to_string(Params.Guesses[0]), 100);
-	Gui::DrawString(220, 120 + this->Delay, 0.45f, TEXT_WHITE, Lang::Get("YOUR_MISSES") + std::to_string(Params.Guesses[1]), 100);
+	GFX::DrawString(220, 80 - this->Delay, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::PAIRS) + std::to_string(Params.PlayerPairs[0]), 150);
+	GFX::DrawString(220, 100 + this->Delay, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::YOUR_TRIES) + std::to_string(Params.Guesses[0]), 100);
+	GFX::DrawString(220, 120 + this->Delay, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::YOUR_MISSES) + std::to_string(Params.Guesses[1]), 100);
 
 
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
@@ -201,60 +209,64 @@ void GameResult::DrawSolo(const GameSettings::GameParams &Params) {
 	This overlay just shows the results of the played game.
 */
 void GameResult::Action(GameSettings::GameParams &Params, const uint8_t Won) {
+	GFX::Invalidate(); // A new screen is shown.
+
 	/* Increase Wins on Versus Mode.. */
 	if (Params.GameMode == GameSettings::GameModes::Versus) {
 		if (Won == 1) Params.Wins[0]++;
 		else if (Won == 2) Params.Wins[1]++;
 	}
 
+	/* Only a real winner gets confetti. */
+	this->HasWinner = (Params.GameMode == GameSettings::GameModes::Versus && Won != 0);
+	if (this->HasWinner && !_3DZwei::CFG->DoAnimation()) this->Confetti.Burst(200, 110, CONFETTI_AMOUNT, 5.0f, ConfettiColors, 4);
+
 	/* Get if the game is fully over. */
 	this->Over = ((Params.GameMode == GameSettings::GameModes::Versus) && (Params.Wins[0] == Params.RoundsToWin || Params.Wins[1] == Params.RoundsToWin));
 	this->ScrollMode = (this->Over && Utils::Cards.size() > 12);
 
 	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-
-		if (this->Over) {
-			Gui::ScreenDraw(Top);
-			Gui::Draw_Rect(0, 25, 400, 215, BG_BLUE); // Draw BG.
-			/* Then the cards. */
-			if (this->DoScrollSwipe || this->InitialScroll) {
-				if (!this->InitialScroll) {
-					if ((this->ScrollPage * 12) + 12 < Utils::Cards.size()) {
-						this->DrawCardBG(this->ScrollPage + 1, this->ScrollIdx - 240);
-
-					} else {
-						this->DrawCardBG(0, this->ScrollIdx - 240);
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			if (this->Over) {
+				GFX::ScreenDraw(Top);
+				Gui::Draw_Rect(0, 25, 400, 215, BG_BLUE); // Draw BG.
+				/* Then the cards. */
+				if (this->DoScrollSwipe || this->InitialScroll) {
+					if (!this->InitialScroll) {
+						if (this->CardGrid.HasPage(this->ScrollPage + 1)) {
+							this->DrawCardBG(this->ScrollPage + 1, this->ScrollIdx - 240);
+
+						} else {
+							this->DrawCardBG(0, this->ScrollIdx - 240);
+						}
 					}
+
+					this->DrawCardBG(this->ScrollPage, this->ScrollIdx);
+
+				} else {
+					this->DrawCardBG(this->ScrollPage, 0);
 				}
 
-				this->DrawCardBG(this->ScrollPage, this->ScrollIdx);
+				Gui::Draw_Rect(0, 0, 400, 25, BAR_BLUE); // Then the Bar, so the cards don't go over it.
+				Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, 190)); // Then the darken.
+				GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_RESULT_TITLE), 395);
+				this->DrawOver(Params.Wins[0] < Params.Wins[1], Params); // Game is fully over.
 
 			} else {
-				this->DrawCardBG(this->ScrollPage, 0);
+				GFX::DrawTop();
+				GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_RESULT_ROUND), 395);
+
+				if (Params.GameMode == GameSettings::GameModes::Solo) this->DrawSolo(Params); // Solo Mode.
+				else {
+					/* Versus Mode. */
+					if (Won == 0) this->DrawVersus(Params.Wins[1] > Params.Wins[0], Params, true); // Tie, so display most winner on top.
+					else this->DrawVersus(Won == 2, Params, false); // There exist a real winner.
+				}
 			}
 
-			Gui::Draw_Rect(0, 0, 400, 25, BAR_BLUE); // Then the Bar, so the cards don't go over it.
-			Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, 190)); // Then the darken.
-			Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("GAME_RESULT_TITLE"), 395);
-			this->DrawOver(Params.Wins[0] < Params.Wins[1], Params); // Game is fully over.
-
-		} else {
-			GFX::DrawTop();
-			Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("GAME_RESULT_ROUND"), 395);
-
-			if (Params.GameMode == GameSettings::GameModes::Solo) this->DrawSolo(Params); // Solo Mode.
-			else {
-				/* Versus Mode. */
-				if (Won == 0) this->DrawVersus(Params.Wins[1] > Params.Wins[0], Params, true); // Tie, so display most winner on top.
-				else this->DrawVersus(Won == 2, Params, false); // There exist a real winner.
-			}
+			GFX::EndFrame();
 		}
 
-		C3D_FrameEnd(0);
 		this->Handler();
 	}
 
@@ -267,8 +279,13 @@ void GameResult::Action(GameSettings::GameParams &Params, const uint8_t Won) {
 
 /* The Handler. */
 void GameResult::Handler() {
-	hidScanInput();
-	const uint32_t Down = hidKeysDown();
+	Input::Scan();
+	const uint32_t Down = Input::Down();
+
+	if (this->Confetti.Active()) {
+		this->Confetti.Tick(Clock::Frames());
+		GFX::Invalidate();
+	}
 
 	if (Down & KEY_A || Down & KEY_TOUCH) {
 		if (!_3DZwei::CFG->DoAnimation()) this->FullDone = true; // No animation -> Directly go to FullDone.
@@ -282,20 +299,21 @@ void GameResult::Handler() {
 	/* Fade and Move Logic. */
 	if (!this->Done && this->DoSwipe) {
 		if (this->Cubic < 255.0f) {
-			this->Cubic = std::lerp(this->Cubic, 256.0f, 0.1f);
+			this->Cubic = Clock::Lerp(this->Cubic, 256.0f, 0.1f);
 			this->Delay = 255 - this->Cubic;
 
 			if (this->Cubic >= 255.0f) {
 				this->Delay = 0;
 				this->Cubic = 0;
 				this->DoSwipe = false;
+				if (this->HasWinner) this->Confetti.Burst(200, 110, CONFETTI_AMOUNT, 5.0f, ConfettiColors, 4); // The winner is in place.
 			}
 		}
 	}
 
 	if (this->Done && this->DoSwipe) {
 		if (this->Cubic < 255.0f) {
-			this->Cubic = std::lerp(this->Cubic, 256.0f, 0.1f);
+			this->Cubic = Clock::Lerp(this->Cubic, 256.0f, 0.1f);
 			this->Delay = this->Cubic;
 
 			if (this->Cubic >= 255.0f) this->Delay = 0, this->Cubic = 0, this->DoSwipe = false, this->FullDone = true;
@@ -305,7 +323,7 @@ void GameResult::Handler() {
 	if (this->Over) {
 		if (this->InitialScroll) {
 			if (this->ScrollCubic < 240.0f) {
-				this->ScrollCubic = std::lerp(this->ScrollCubic, 241.0f, 0.1f);
+				this->ScrollCubic = Clock::Lerp(this->ScrollCubic, 241.0f, 0.1f);
 				this->ScrollIdx = (-240) + this->ScrollCubic;
 
 				if (this->ScrollCubic >= 240.0f) {
@@ -322,12 +340,12 @@ void GameResult::Handler() {
 
 			if (this->DoScrollSwipe) {
 				if (this->ScrollCubic < 240.0f) {
-					this->ScrollCubic = std::lerp(this->ScrollCubic, 241.0f, 0.1f);
+					this->ScrollCubic = Clock::Lerp(this->ScrollCubic, 241.0f, 0.1f);
 					this->ScrollIdx = this->ScrollCubic;
 
 					if (this->ScrollCubic >= 240.0f) {
 						this->ScrollCubic = 0.0f, this->ScrollIdx = 0;
-						this->ScrollPage = (((this->ScrollPage * 12) + 12 < Utils::Cards.size()) ? this->ScrollPage + 1 : 0);
+						this->ScrollPage = (this->CardGrid.HasPage(this->ScrollPage + 1) ? this->ScrollPage + 1 : 0);
 						this->DoScrollSwipe = false;
 					}
 				}
@@ -335,10 +353,10 @@ void GameResult::Handler() {
 				return;
 			}
 
-			if (this->ScrollDelay > 0) {
-				this->ScrollDelay--;
+			if (this->ScrollDelay > 0.0f) {
+				this->ScrollDelay = std::max(0.0f, this->ScrollDelay - Clock::Frames());
 
-				if (this->ScrollDelay == 0) this->DoScrollSwipe = true, this->ScrollDelay = 60;
+				if (this->ScrollDelay == 0.0f) this->DoScrollSwipe = true, this->ScrollDelay = 60.0f;
 			}
 		}
 	}
@@ -36,6 +36,9 @@
 #include "Keyboard.hpp"
 #include "Numpad.hpp"
 
+/* Fades. */
+#include "Transition.hpp"
+
 /* Card Utils. */
 #include "Utils.hpp"
 
@@ -162,7 +165,7 @@ void GameSettings::SelectPicture(const bool AI) {
 /* If Card Delay used -> Set the delay. */
 void GameSettings::SetCardDelay() {
 	if (this->Params.CardDelayUsed) {
-		std::unique_ptr<Numpad> Ovl = std::make_unique<Numpad>(3, this->Params.CardDelay, 255, Lang::Get("GAME_SETTINGS_CARD_DELAY_TXT"));
+		std::unique_ptr<Numpad> Ovl = std::make_unique<Numpad>(3, this->Params.CardDelay, 255, Lang::Get(Lang::Str::GAME_SETTINGS_CARD_DELAY_TXT));
 		this->Params.CardDelay = Ovl->Action();
 	}
 }
@@ -171,7 +174,7 @@ void GameSettings::SetCardDelay() {
 /* Set the amount of wins you need to win the game. */
 void GameSettings::SetWinRounds() {
 	if (this->Params.GameMode == GameSettings::GameModes::Versus) { // Only available on Versus Mode.
-		std::unique_ptr<Numpad> Ovl = std::make_unique<Numpad>(3, this->Params.RoundsToWin, 255, Lang::Get("GAME_SETTINGS_ROUND_WIN_TXT"));
+		std::unique_ptr<Numpad> Ovl = std::make_unique<Numpad>(3, this->Params.RoundsToWin, 255, Lang::Get(Lang::Str::GAME_SETTINGS_ROUND_WIN_TXT));
 		this->Params.RoundsToWin = Ovl->Action();
 	}
 }
@@ -185,12 +188,12 @@ void GameSettings::SetWinRounds() {
 void GameSettings::SetName(const bool AI) {
 	if (AI) {
 		if (this->Params.GameMode == GameSettings::GameModes::Versus) { // 2 Player only available on Versus Mode.
-			std::unique_ptr<Keyboard> Ovl = std::make_unique<Keyboard>(16, this->Params.Names[1], Lang::Get("GAME_SETTINGS_P2_ENTER_NAME"));
+			std::unique_ptr<Keyboard> Ovl = std::make_unique<Keyboard>(16, this->Params.Names[1], Lang::Get(Lang::Str::GAME_SETTINGS_P2_ENTER_NAME));
 			this->Params.Names[1] = Ovl->Action();
 		}
 
 	} else {
-		std::unique_ptr<Keyboard> Ovl = std::make_unique<Keyboard>(16, this->Params.Names[0], Lang::Get("GAME_SETTINGS_P1_ENTER_NAME"));
+		std::unique_ptr<Keyboard> Ovl = std::make_unique<Keyboard>(16, this->Params.Names[0], Lang::Get(Lang::Str::GAME_SETTINGS_P1_ENTER_NAME));
 		this->Params.Names[0] = Ovl->Action();
 	}
 }
@@ -199,7 +202,7 @@ void GameSettings::SetName(const bool AI) {
 /* Draw the Overlay. */
 void GameSettings::Draw(const bool IsSetting) {
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, (IsSetting ? Lang::Get("SETTINGS_GAME_DEFAULTS") : Lang::Get("GAME_SETTINGS_TITLE")), 395);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, (IsSetting ? Lang::Get(Lang::Str::SETTINGS_GAME_DEFAULTS) : Lang::Get(Lang::Str::GAME_SETTINGS_TITLE)), 395);
 	Gui::DrawSprite(GFX::Sprites, sprites_logo_idx, 72, 69); // Display Logo.
 
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
@@ -211,44 +214,44 @@ void GameSettings::Draw(const bool IsSetting) {
 	/* Draw Tabs. */
 	if (this->Tab != Tabs::General) Gui::Draw_Rect(0, 0, 160, 20, BAR_BLUE);
 	if (this->Tab != Tabs::Player) Gui::Draw_Rect(160, 0, 160, 20, BAR_BLUE);
-	Gui::DrawStringCentered(-80, 3, 0.45f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_TAB_GENERAL"), 150);
-	Gui::DrawStringCentered(80, 3, 0.45f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_TAB_PLAYERS"), 150);
+	GFX::DrawStringCentered(-80, 3, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_TAB_GENERAL), 150);
+	GFX::DrawStringCentered(80, 3, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_TAB_PLAYERS), 150);
 
 	/* Only draw General Tab, if the Tab is larger as -320. */
 	if (this->T1Offs > -320) {
 		/* Game Mode. */
-		Gui::DrawString(15 + this->T1Offs, this->GeneralPos[2].Y + 5 - (Lang::Get("GAME_SETTINGS_GM").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_GM"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->T1Offs, this->GeneralPos[2].Y + 5 - (Lang::Get(Lang::Str::GAME_SETTINGS_GM).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_GM), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, 150 + this->T1Offs, this->GeneralPos[2].Y);
 
 		switch(this->Params.GameMode) {
 			case GameSettings::GameModes::Versus:
-				Gui::DrawString(190 + this->T1Offs, this->GeneralPos[2].Y + 5, 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_GM_NORMAL"), 120);
+				GFX::DrawString(190 + this->T1Offs, this->GeneralPos[2].Y + 5, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_GM_NORMAL), 120);
 				break;
 
 			case GameSettings::GameModes::Solo:
-				Gui::DrawString(190 + this->T1Offs, this->GeneralPos[2].Y + 5, 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_GM_TRIES"), 120);
+				GFX::DrawString(190 + this->T1Offs, this->GeneralPos[2].Y + 5, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_GM_TRIES), 120);
 				break;
 		}
 
 
 		/* Using Card Delay. */
-		Gui::DrawString(15 + this->T1Offs, this->GeneralPos[3].Y + 5 - (Lang::Get("GAME_SETTINGS_CARD_DELAY").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_CARD_DELAY"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->T1Offs, this->GeneralPos[3].Y + 5 - (Lang::Get(Lang::Str::GAME_SETTINGS_CARD_DELAY).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_CARD_DELAY), 125, 15, nullptr, C2D_WordWrap);
 		GFX::DrawCheckbox(150 + this->T1Offs, this->GeneralPos[3].Y, this->Params.CardDelayUsed);
 
 		/* Card Delay Value. */
 		if (this->Params.CardDelayUsed) { // Only show if Card Delay enabled.
 			Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, 200 + this->T1Offs, this->GeneralPos[3].Y);
-			Gui::DrawString(240 + this->T1Offs, this->GeneralPos[3].Y + 5, 0.4f, TEXT_WHITE, std::to_string(this->Params.CardDelay));
+			GFX::DrawString(240 + this->T1Offs, this->GeneralPos[3].Y + 5, 0.4f, TEXT_WHITE, std::to_string(this->Params.CardDelay));
 		}
 
 		/* Card Pairs. */
-		Gui::DrawString(15 + this->T1Offs, this->GeneralPos[5].Y + 5 - (Lang::Get("GAME_SETTINGS_CARD_PAIRS").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_CARD_PAIRS"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->T1Offs, this->GeneralPos[5].Y + 5 - (Lang::Get(Lang::Str::GAME_SETTINGS_CARD_PAIRS).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_CARD_PAIRS), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, 150 + this->T1Offs, this->GeneralPos[5].Y);
-		Gui::DrawString(190 + this->T1Offs, this->GeneralPos[5].Y + 5, 0.4f, TEXT_WHITE, std::to_string(Utils::Cards.size()));
+		GFX::DrawString(190 + this->T1Offs, this->GeneralPos[5].Y + 5, 0.4f, TEXT_WHITE, std::to_string(Utils::Cards.size()));
 
 		/* Using AI. */
 		if (this->Params.GameMode == GameSettings::GameModes::Versus) { // Only available in Versus Mode.
-			Gui::DrawString(15 + this->T1Offs, this->GeneralPos[6].Y + 5 - (Lang::Get("GAME_SETTINGS_AI_METHOD").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_AI_METHOD"), 125, 15, nullptr, C2D_WordWrap);
+			GFX::DrawString(15 + this->T1Offs, this->GeneralPos[6].Y + 5 - (Lang::Get(Lang::Str::GAME_SETTINGS_AI_METHOD).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_AI_METHOD), 125, 15, nullptr, C2D_WordWrap);
 			GFX::DrawCheckbox(150 + this->T1Offs, this->GeneralPos[6].Y, this->Params.AIUsed);
 
 			/* AI Method. */
@@ -257,27 +260,27 @@ void GameSettings::Draw(const bool IsSetting) {
 
 				switch(this->Params.Method) {
 					case StackMem::AIMethod::Random:
-						Gui::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_AI_RANDOM"), 70);
+						GFX::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_AI_RANDOM), 70);
 						break;
 
 					case StackMem::AIMethod::Medium:
-						Gui::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_AI_MEDIUM"), 70);
+						GFX::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_AI_MEDIUM), 70);
 						break;
 
 					case StackMem::AIMethod::Hard:
-						Gui::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_AI_HARD"), 70);
+						GFX::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_AI_HARD), 70);
 						break;
 
 					case StackMem::AIMethod::Extreme:
-						Gui::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_AI_EXTREME"), 70);
+						GFX::DrawString(240 + this->T1Offs, this->GeneralPos[6].Y + 5, 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_AI_EXTREME), 70);
 						break;
 				}
 			}
 
 			/* Rounds to win Value. */
-			Gui::DrawString(15 + this->T1Offs, this->GeneralPos[8].Y + 5 - (Lang::Get("GAME_SETTINGS_ROUND_WIN").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_ROUND_WIN"), 125, 15, nullptr, C2D_WordWrap);
+			GFX::DrawString(15 + this->T1Offs, this->GeneralPos[8].Y + 5 - (Lang::Get(Lang::Str::GAME_SETTINGS_ROUND_WIN).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_ROUND_WIN), 125, 15, nullptr, C2D_WordWrap);
 			Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, 150 + this->T1Offs, this->GeneralPos[8].Y);
-			Gui::DrawString(190 + this->T1Offs, this->GeneralPos[8].Y + 5, 0.4f, TEXT_WHITE, std::to_string(this->Params.RoundsToWin));
+			GFX::DrawString(190 + this->T1Offs, this->GeneralPos[8].Y + 5, 0.4f, TEXT_WHITE, std::to_string(this->Params.RoundsToWin));
 		}
 	}
 
@@ -287,39 +290,39 @@ void GameSettings::Draw(const bool IsSetting) {
 		if (this->Params.Characters[0] < Utils::GetCharSheetSize()) Gui::DrawSprite(GFX::Characters, this->Params.Characters[0], 30 + this->T2Offs, 30);
 		Gui::DrawSprite(GFX::Sprites, sprites_outline_idx, 28 + this->T2Offs, 28);
 		Gui::Draw_Rect(37 + this->T2Offs, 159, 106, 20, BAR_BLUE);
-		Gui::DrawString(40 + this->T2Offs, 162, 0.45f, TEXT_WHITE, this->Params.Names[0], 100);
+		GFX::DrawString(40 + this->T2Offs, 162, 0.45f, TEXT_WHITE, this->Params.Names[0], 100);
 
 		/* Player 2. */
 		if (this->Params.GameMode == GameSettings::GameModes::Versus) { // Only available in Versus Mode.
 			if (this->Params.Characters[1] < Utils::GetCharSheetSize()) Gui::DrawSprite(GFX::Characters, this->Params.Characters[1], 170 + this->T2Offs, 30);
 			Gui::DrawSprite(GFX::Sprites, sprites_outline_idx, 168 + this->T2Offs, 28);
 			Gui::Draw_Rect(177 + this->T2Offs, 159, 106, 20, BAR_BLUE);
-			Gui::DrawString(180 + this->T2Offs, 162, 0.45f, TEXT_WHITE, this->Params.Names[1], 100);
+			GFX::DrawString(180 + this->T2Offs, 162, 0.45f, TEXT_WHITE, this->Params.Names[1], 100);
 		}
 
 		if (this->Params.GameMode == GameSettings::GameModes::Versus) { // Only available in Versus Mode.
-			Gui::DrawString(15 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get("GAME_SETTINGS_STARTER"), 130);
+			GFX::DrawString(15 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::GAME_SETTINGS_STARTER), 130);
 			Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, 150 + this->T2Offs, 195);
 
 			switch(this->Params.Starter) {
 				case GameSettings::RoundStarter::Player1:
-					Gui::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, this->Params.Names[0], 120);
+					GFX::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, this->Params.Names[0], 120);
 					break;
 
 				case GameSettings::RoundStarter::Player2:
-					Gui::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, this->Params.Names[1], 120);
+					GFX::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, this->Params.Names[1], 120);
 					break;
 
 				case GameSettings::RoundStarter::Random:
-					Gui::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get("RANDOM"), 120);
+					GFX::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::RANDOM), 120);
 					break;
 
 				case GameSettings::RoundStarter::Loser:
-					Gui::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get("LOSER"), 120);
+					GFX::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::LOSER), 120);
 					break;
 
 				case GameSettings::RoundStarter::Winner:
-					Gui::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get("WINNER"), 120);
+					GFX::DrawString(190 + this->T2Offs, 200, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::WINNER), 120);
 					break;
 			}
 		}
@@ -340,46 +343,36 @@ void GameSettings::Draw(const bool IsSetting) {
 /* Handle Fade-Outs. */
 void GameSettings::FadeOut() {
 	this->FAlpha = 0;
-
-	while(aptMainLoop() && this->FAlpha < 255) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->Draw();
-		C3D_FrameEnd(0);
-
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if ((!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) || Down) this->FAlpha = 255;
-		else this->FAlpha += 5;
-	}
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(this->IsSetting); }, true);
+	this->FAlpha = 255;
 }
 
 
 /* MAIN Action! */
 GameSettings::GameParams GameSettings::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	Pointer::OnTop = false;
 	Pointer::SetPos(0, 0);
 
 	/* Get the Player Names from the Translations if not from the defaults. */
-	if (this->Params.Names[0] == "%Player1%") this->Params.Names[0] = Lang::Get("PLAYER_1");
-	if (this->Params.Names[1] == "%Player2%") this->Params.Names[1] = Lang::Get("PLAYER_2");
+	if (this->Params.Names[0] == "%Player1%") this->Params.Names[0] = Lang::Get(Lang::Str::PLAYER_1);
+	if (this->Params.Names[1] == "%Player2%") this->Params.Names[1] = Lang::Get(Lang::Str::PLAYER_2);
 
 	/* Check for in range, and if out of range, set to 0. */
 	if (this->Params.Characters[0] >= Utils::GetCharSheetSize()) this->Params.Characters[0] = 0;
 	if (this->Params.Characters[1] >= Utils::GetCharSheetSize()) this->Params.Characters[1] = 0;
 
-	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->Draw(this->IsSetting);
-		C3D_FrameEnd(0);
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw(this->IsSetting);
+			GFX::EndFrame();
+		}
+
 		this->TabLogic();
 	}
 
+	this->FadeOut();
 	Pointer::SetPos(0, 0);
 	return this->Params;
 }
@@ -387,27 +380,13 @@ GameSettings::GameParams GameSettings::Action() {
 
 /* Handles the Tab Logic. */
 void GameSettings::TabLogic() {
-	hidScanInput();
-	const uint32_t Down = hidKeysDown();
-
-	/* Because we gave it an OK, we're done and fade out. */
-	if (this->Done) {
-		if (this->FAlpha < 255) {
-			if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FAlpha = 0, this->FullDone = true;
-			else {
-				this->FAlpha += 5;
-
-				if (this->FAlpha >= 255) this->FullDone = true;
-			}
-		}
-
-		return;
-	}
+	Input::Scan();
+	const uint32_t Down = Input::Down();
 
 	/* Basically Fade-In handler. */
 	if (this->FAlpha > 0) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0;
-		else this->FAlpha -= 5;
+		else this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 	}
 
 	/* Initial Swipe in the first tab. */
@@ -419,7 +398,7 @@ void GameSettings::TabLogic() {
 
 		} else {
 			if (this->T1Offs <= 0) {
-				this->Cubic = std::lerp(this->Cubic, 321.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.1f);
 				this->T1Offs = -320 + this->Cubic;
 
 				if (this->Cubic >= 320.0f) {
@@ -446,7 +425,7 @@ void GameSettings::TabLogic() {
 
 			} else {
 				if (this->Cubic < 320.0f) {
-					this->Cubic = std::lerp(this->Cubic, 321.0f, 0.1f);
+					this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.1f);
 
 					this->T1Offs = 0 - this->Cubic;
 					this->T2Offs = 320 - this->Cubic;
@@ -471,7 +450,7 @@ void GameSettings::TabLogic() {
 
 			} else {
 				if (this->Cubic < 320.0f) {
-					this->Cubic = std::lerp(this->Cubic, 321.0f, 0.1f);
+					this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.1f);
 					this->T2Offs = this->Cubic;
 					this->T1Offs = -320 + this->Cubic;
 
@@ -490,8 +469,8 @@ void GameSettings::TabLogic() {
 	}
 
 	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Held = hidKeysHeld();
+	Input::TouchRead(&T);
+	const uint32_t Held = Input::Held();
 	Pointer::ScrollHandling(Held);
 
 	if (Down & KEY_B) this->Cancel();
@@ -501,31 +480,13 @@ void GameSettings::TabLogic() {
 
 	switch(this->Tab) {
 		case Tabs::General:
-			if (Down & KEY_A) {
-				for (auto &Position : this->GeneralPos) {
-					if (Pointer::Clicked(Position, true)) break;
-				}
-			}
-
-			if (Down & KEY_TOUCH) {
-				for (auto &Position : this->GeneralPos) {
-					if (Touched(Position, T, true)) break;
-				}
-			}
+			if (Down & KEY_A) this->GeneralPosIndex.Clicked();
+			if (Down & KEY_TOUCH) this->GeneralPosIndex.Touched(T);
 			break;
 
 		case Tabs::Player:
-			if (Down & KEY_A) {
-				for (auto &Position : this->PlayerPos) {
-					if (Pointer::Clicked(Position, true)) break;
-				}
-			}
-
-			if (Down & KEY_TOUCH) {
-				for (auto &Position : this->PlayerPos) {
-					if (Touched(Position, T, true)) break;
-				}
-			}
+			if (Down & KEY_A) this->PlayerPosIndex.Clicked();
+			if (Down & KEY_TOUCH) this->PlayerPosIndex.Touched(T);
 			break;
 	}
 }
\ No newline at end of file
@@ -50,13 +50,15 @@ Numpad::Numpad(const int MaxLength, const int OldNum, const int MaxVal, const st
 
 /* The numpad action. */
 int Numpad::Action() {
+	GFX::Invalidate(); // The caller needs to redraw after the software keyboard.
+
 	/* Display one frame on top of what should be entered. */
 	C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
 	C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
 	Gui::clearTextBufs();
 	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, this->Text, 395);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, this->Text, 395);
 	Gui::DrawSprite(GFX::Sprites, sprites_logo_idx, 72, 69);
 	GFX::DrawBottom();
 	C3D_FrameEnd(0);
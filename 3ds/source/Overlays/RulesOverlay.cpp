@@ -26,18 +26,22 @@
 
 #include "Common.hpp"
 #include "RulesOverlay.hpp"
+#include "Transition.hpp" // Fade-Out.
 
 
 /* STATE 1: Handle Going to first card. */
 void RulesOverlay::State1() {
+	const float Step = 2.0f * Clock::Frames(); // 2 pixels per 60 FPS frame.
+	GFX::Invalidate(); // The pointer moves.
+
 	if (this->X > this->Cards[0].X + 20) {
-		this->X -= 2;
+		this->X = std::max(this->Cards[0].X + 20, this->X - Step);
 
 		if (this->X != this->Cards[0].X + 20) return;
 	}
 
 	if (this->Y > this->Cards[0].Y + 20) {
-		this->Y -= 2;
+		this->Y = std::max(this->Cards[0].Y + 20, this->Y - Step);
 
 		if (this->Y != this->Cards[0].Y + 20) return;
 	}
@@ -52,7 +56,7 @@ void RulesOverlay::State2() {
 	if (!this->FlipDone[0]) {
 		if (!this->CardFlipped[0]) { // Scale down the back cover -- first operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 
 				this->CardScale[0] = 1.0f - Cubic;
 
@@ -65,7 +69,7 @@ void RulesOverlay::State2() {
 
 		} else { // Scale up the front cover -- second operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 				this->CardScale[0] = this->Cubic;
 
 				if (this->Cubic >= 1.0f) {
@@ -83,14 +87,17 @@ void RulesOverlay::State2() {
 
 /* STATE 3: Handle Going to second card. */
 void RulesOverlay::State3() {
+	const float Step = 2.0f * Clock::Frames(); // 2 pixels per 60 FPS frame.
+	GFX::Invalidate(); // The pointer moves.
+
 	if (this->X < this->Cards[19].X + 20) {
-		this->X += 2;
+		this->X = std::min(this->Cards[19].X + 20, this->X + Step);
 
 		if (this->X != this->Cards[19].X + 20) return;
 	}
 
 	if (this->Y < this->Cards[19].Y + 20) {
-		this->Y += 2;
+		this->Y = std::min(this->Cards[19].Y + 20, this->Y + Step);
 
 		if (this->Y != this->Cards[19].Y + 20) return;
 	}
@@ -105,7 +112,7 @@ void RulesOverlay::State4() {
 	if (!this->FlipDone[1]) {
 		if (!this->CardFlipped[1]) { // Scale down the back cover -- first operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 
 				this->CardScale[1] = 1.0f - Cubic;
 
@@ -118,7 +125,7 @@ void RulesOverlay::State4() {
 
 		} else { // Scale up the front cover -- second operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 				this->CardScale[1] = this->Cubic;
 
 				if (this->Cubic >= 1.0f) {
@@ -136,13 +143,13 @@ void RulesOverlay::State4() {
 
 /* STATE 5: Wait for the delay and flip cards back. */
 void RulesOverlay::State5() {
-	if (this->Delay > 0) this->Delay--;
+	if (this->Delay > 0.0f) this->Delay = std::max(0.0f, this->Delay - Clock::Frames());
 
 	/* Handle Flip back. */
-	if (this->Delay == 0) { // After delay -> Handle back flip.
+	if (this->Delay == 0.0f) { // After delay -> Handle back flip.
 		if (this->CardFlipped[0]) { // Scale down the back cover -- first operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 
 				this->CardScale[0] = 1.0f - this->Cubic, this->CardScale[1] = 1.0f - this->Cubic;
 
@@ -155,7 +162,7 @@ void RulesOverlay::State5() {
 
 		} else { // Scale up the front cover -- second operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 
 				this->CardScale[0] = this->Cubic, this->CardScale[1] = this->Cubic;
 
@@ -167,8 +174,8 @@ void RulesOverlay::State5() {
 		}
 	}
 
-	if (this->Delay == 0 && !this->FlipDone[0] && !this->FlipDone[1]) {
-		this->Delay = 100;
+	if (this->Delay == 0.0f && !this->FlipDone[0] && !this->FlipDone[1]) {
+		this->Delay = 100.0f;
 
 		this->Cubic = 0.0f;
 		this->State = States::GotoFirst;
@@ -178,25 +185,10 @@ void RulesOverlay::State5() {
 
 /* Handle the States. */
 void RulesOverlay::StateHandler() {
-	/* Handle Fade-Out. */
-	if (this->Done) {
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FAlpha = 255, this->FullDone = true;
-		else {
-			if (this->FAlpha < 255) this->FAlpha += 5;
-			if (this->FAlpha == 255) this->FullDone = true;
-		}
-
-		return;
-
 	/* Handle Fade-In. */
-	} else {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0;
-		else {
-			if (this->FAlpha > 0) this->FAlpha -= 5;
-		}
+	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0;
+	else {
+		if (this->FAlpha > 0) this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 	}
 
 	switch(this->State) {
@@ -223,47 +215,54 @@ void RulesOverlay::StateHandler() {
 }
 
 
-void RulesOverlay::Action() {
-	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		GFX::DrawTop();
-		Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("RULES_TITLE"), 395);
-		Gui::DrawStringCentered(0, 40, 0.55f, TEXT_WHITE, Lang::Get("RULES_DESC"), 380, 160, nullptr, C2D_WordWrap);
-
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-		}
+/* Draws both screens, with the fade. */
+void RulesOverlay::Draw() {
+	GFX::DrawTop();
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::RULES_TITLE), 395);
+	GFX::DrawStringCentered(0, 40, 0.55f, TEXT_WHITE, Lang::Get(Lang::Str::RULES_DESC), 380, 160, nullptr, C2D_WordWrap);
 
-		GFX::DrawBottom();
-		Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
 
-		/* First real card. */
-		if (this->CardFlipped[0]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
-		else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
+	GFX::DrawBottom();
+	Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
 
-		/* Hidden cards. */
-		for (uint8_t Idx = 1; Idx < 19; Idx++) {
-			Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[Idx].X, this->Cards[Idx].Y);
-		}
+	/* First real card. */
+	if (this->CardFlipped[0]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
+	else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
 
-		/* Second real card. */
-		if (this->CardFlipped[1]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[19].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[19].Y, this->CardScale[1], 1.0f);
-		else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[19].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[19].Y, this->CardScale[1], 1.0f);
+	/* Hidden cards. */
+	for (uint8_t Idx = 1; Idx < 19; Idx++) {
+		Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[Idx].X, this->Cards[Idx].Y);
+	}
 
+	/* Second real card. */
+	if (this->CardFlipped[1]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[19].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[19].Y, this->CardScale[1], 1.0f);
+	else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[19].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[19].Y, this->CardScale[1], 1.0f);
 
-		Gui::DrawSprite(GFX::Sprites, sprites_pointer_idx, this->X, this->Y);
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-		}
 
-		C3D_FrameEnd(0);
+	Gui::DrawSprite(GFX::Sprites, sprites_pointer_idx, this->X, this->Y);
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
+}
+
 
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
+void RulesOverlay::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw();
+			GFX::EndFrame();
+		}
+
+		Input::Scan();
+		const uint32_t Down = Input::Down();
 		if (Down) this->Done = true; // Any key -> Skip.
-		this->StateHandler();
+		this->StateHandler(); // Only the moves, flips and fades invalidate, so the wait delay can idle.
 	}
+
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(); }, true);
 }
\ No newline at end of file
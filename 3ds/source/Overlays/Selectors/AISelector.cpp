@@ -26,6 +26,7 @@
 
 #include "AISelector.hpp"
 #include "Common.hpp"
+#include "Transition.hpp" // Fade-Out.
 
 
 AISelector::AISelector(const StackMem::AIMethod Method) {
@@ -77,65 +78,71 @@ void AISelector::Cancel() {
 
 void AISelector::DrawPage(const int16_t Pg, const int AddOffs) {
 	if (Pg < 4) {
-		Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("AI_METHOD") + Lang::Get(this->Modes[Pg]), 395);
-		Gui::DrawStringCentered(0 + AddOffs, 70, 0.5f, TEXT_WHITE, Lang::Get(this->ModeDesc[Pg]), 330, 140, nullptr, C2D_WordWrap);
+		GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::AI_METHOD) + Lang::Get(this->Modes[Pg]), 395);
+		GFX::DrawStringCentered(0 + AddOffs, 70, 0.5f, TEXT_WHITE, Lang::Get(this->ModeDesc[Pg]), 330, 140, nullptr, C2D_WordWrap);
 	}
 }
 
 
-StackMem::AIMethod AISelector::Action() {
-	Pointer::OnTop = true;
-	Pointer::SetPos(0, 0);
+/* Draws both screens, with the fade. */
+void AISelector::Draw() {
+	GFX::DrawTop();
+	/* Draw Content. */
+	if (this->DoSwipe || this->InitialSwipe) { // We swipe.
+		this->DrawPage(this->Mode, this->CurPos); // Draw current page.
 
-	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+		if (this->SwipeDirection) this->DrawPage(this->Mode - 1, this->PrevPos);
+		else this->DrawPage(this->Mode + 1, this->NextPos);
 
-		GFX::DrawTop();
-		/* Draw Content. */
-		if (this->DoSwipe || this->InitialSwipe) { // We swipe.
-			this->DrawPage(this->Mode, this->CurPos); // Draw current page.
+	} else { // No swipe.
+		this->DrawPage(this->Mode, 0); // Draw current page only.
+	}
 
-			if (this->SwipeDirection) this->DrawPage(this->Mode - 1, this->PrevPos);
-			else this->DrawPage(this->Mode + 1, this->NextPos);
+	GFX::DrawCornerEdge(true, this->Positions[0].X, this->Positions[0].Y, this->Positions[0].H, this->Mode > 0);
+	GFX::DrawCornerEdge(false, this->Positions[1].X, this->Positions[1].Y, this->Positions[1].H, this->Mode < 3);
+	Gui::Draw_Rect(this->Positions[2].X, this->Positions[2].Y, this->Positions[2].W, this->Positions[2].H, BAR_BLUE);
+	GFX::DrawStringCentered(0, this->Positions[2].Y + 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::SELECT));
 
-		} else { // No swipe.
-			this->DrawPage(this->Mode, 0); // Draw current page only.
-		}
+	Pointer::Draw();
+
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
 
-		GFX::DrawCornerEdge(true, this->Positions[0].X, this->Positions[0].Y, this->Positions[0].H, this->Mode > 0);
-		GFX::DrawCornerEdge(false, this->Positions[1].X, this->Positions[1].Y, this->Positions[1].H, this->Mode < 3);
-		Gui::Draw_Rect(this->Positions[2].X, this->Positions[2].Y, this->Positions[2].W, this->Positions[2].H, BAR_BLUE);
-		Gui::DrawStringCentered(0, this->Positions[2].Y + 3, 0.6f, TEXT_WHITE, Lang::Get("SELECT"));
+	GFX::DrawBottom();
+	Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
+	GFX::DrawCornerEdge(true, this->BottomPos[0].X, this->BottomPos[0].Y, this->BottomPos[0].H, this->Mode > 0);
+	GFX::DrawCornerEdge(false, this->BottomPos[2].X, this->BottomPos[2].Y, this->BottomPos[2].H, this->Mode < 3);
 
-		Pointer::Draw();
+	Gui::Draw_Rect(95, 105, 130, 30, BAR_BLUE);
+	Gui::Draw_Rect(this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].W, this->BottomPos[1].H, BG_BLUE);
+	GFX::DrawStringCentered(0, this->BottomPos[1].Y + 3, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::SELECT));
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-		}
+	Gui::Draw_Rect(this->BottomPos[3].X, this->BottomPos[3].Y, this->BottomPos[3].W, this->BottomPos[3].H, BAR_BLUE); // Back.
+	Gui::DrawSprite(GFX::Sprites, sprites_back_btn_idx, this->BottomPos[3].X, this->BottomPos[3].Y);
+
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
+}
 
-		GFX::DrawBottom();
-		Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
-		GFX::DrawCornerEdge(true, this->BottomPos[0].X, this->BottomPos[0].Y, this->BottomPos[0].H, this->Mode > 0);
-		GFX::DrawCornerEdge(false, this->BottomPos[2].X, this->BottomPos[2].Y, this->BottomPos[2].H, this->Mode < 3);
 
-		Gui::Draw_Rect(95, 105, 130, 30, BAR_BLUE);
-		Gui::Draw_Rect(this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].W, this->BottomPos[1].H, BG_BLUE);
-		Gui::DrawStringCentered(0, this->BottomPos[1].Y + 3, 0.5f, TEXT_WHITE, Lang::Get("SELECT"));
+StackMem::AIMethod AISelector::Action() {
+	GFX::Invalidate(); // A new screen is shown.
 
-		Gui::Draw_Rect(this->BottomPos[3].X, this->BottomPos[3].Y, this->BottomPos[3].W, this->BottomPos[3].H, BAR_BLUE); // Back.
-		Gui::DrawSprite(GFX::Sprites, sprites_back_btn_idx, this->BottomPos[3].X, this->BottomPos[3].Y);
+	Pointer::OnTop = true;
+	Pointer::SetPos(0, 0);
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw();
+			GFX::EndFrame();
 		}
 
-		C3D_FrameEnd(0);
 		this->Handler();
 	}
 
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(); }, true);
 	Pointer::OnTop = false;
 	Pointer::SetPos(0, 0);
 	if (!this->Cancelled) this->Res = (StackMem::AIMethod)this->Mode; // Only set if NOT cancelled.
@@ -145,34 +152,23 @@ StackMem::AIMethod AISelector::Action() {
 
 /* Action Handler. */
 void AISelector::Handler() {
-	hidScanInput();
+	Input::Scan();
 	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Down = hidKeysDown();
-	const uint32_t Held = hidKeysHeld();
+	Input::TouchRead(&T);
+	const uint32_t Down = Input::Down();
+	const uint32_t Held = Input::Held();
 
 	/* Fade-In Handler. */
 	if (this->FadeIn) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0, this->FadeIn = false;
 
 		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
+			this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 			if (this->FAlpha <= 0) this->FadeIn = false;
 		}
 	}
 
-	/* Fade-Out Handler. */
-	if (this->Done) {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FullDone = true;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FullDone = true;
-		}
-	}
-
 	/* Initial Swipe. */
 	if (this->InitialSwipe) {
 		if (!_3DZwei::CFG->DoAnimation()) {
@@ -181,7 +177,7 @@ void AISelector::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 			this->CurPos = -400 + this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -202,7 +198,7 @@ void AISelector::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 
 			if (this->SwipeDirection) { // -> (Last).
 				this->CurPos = this->Cubic, this->PrevPos = -400 + this->Cubic;
@@ -226,17 +222,8 @@ void AISelector::Handler() {
 	if (Down & KEY_L) this->PrevMode();
 	if (Down & KEY_R) this->NextMode();
 
-	if (Down & KEY_A) {
-		for (auto &Position : this->Positions) {
-			if (Pointer::Clicked(Position, true)) break;
-		}
-	}
-
-	if (Down & KEY_TOUCH) {
-		for (auto &Position : this->BottomPos) {
-			if (Touched(Position, T, true)) break;
-		}
-	}
+	if (Down & KEY_A) this->PositionsIndex.Clicked();
+	if (Down & KEY_TOUCH) this->BottomPosIndex.Touched(T);
 
 	if (Down & KEY_START || Down & KEY_B) this->OK(); // Exit with START or B as well.
 }
\ No newline at end of file
@@ -26,6 +26,7 @@
 
 #include "CardSelector.hpp"
 #include "Common.hpp"
+#include "Transition.hpp" // Fade-Out.
 #include "Utils.hpp"
 
 
@@ -36,13 +37,17 @@ CardSelector::CardSelector() {
 	if (!Utils::Cards.empty()) {
 		for (size_t Idx = 0; Idx < Utils::Cards.size(); Idx++) this->Cards[Utils::Cards[Idx]] = true;
 	}
+
+	this->CardGrid.Resize(this->Cards.size()), this->BoxGrid.Resize(this->Cards.size()), this->BottomGrid.Resize(this->Cards.size());
 }
 
 
 /* Toggle the specified indexes card. */
 void CardSelector::ToggleCard(const uint8_t Idx) {
-	if (((this->Page * 9) + Idx) < this->Cards.size()) {
-		this->Cards[(this->Page * 9) + Idx] = !this->Cards[(this->Page * 9) + Idx];
+	const int Card = this->CardGrid.Index(this->Page, Idx);
+
+	if (Card >= 0) {
+		this->Cards[Card] = !this->Cards[Card];
 		if (!this->Changed) this->Changed = true;
 	}
 }
@@ -64,7 +69,7 @@ void CardSelector::SelectNone() {
 
 /* Go to the previous page. */
 void CardSelector::PrevPage() {
-	if (this->Page > 0) {
+	if (this->Page > 0 && !this->Dragging) {
 		this->SwipeDir = true;
 		this->DoSwipe = true;
 	}
@@ -73,51 +78,75 @@ void CardSelector::PrevPage() {
 
 /* Go to the next page. */
 void CardSelector::NextPage() {
-	if (this->CanGoNext()) {
+	if (this->CanGoNext() && !this->Dragging) {
 		this->SwipeDir = false;
 		this->DoSwipe = true;
 	}
 }
 
 
+/* Moves the current page and the one in swipe direction by Cubic. */
+void CardSelector::MovePages() {
+	this->CurPos = (this->SwipeDir ? this->Cubic : 0 - this->Cubic);
+	this->PrevPos = -400 + (this->SwipeDir ? this->Cubic : 0.0f); // -> (Last).
+	this->NextPos = 400 - (this->SwipeDir ? 0.0f : this->Cubic); // <- (Next).
+}
+
+
+/*
+	Moves the pages with the finger. The drag on the touch screen is scaled to the wider top screen.
+
+	const float DX: The horizontal distance of the drag.
+*/
+void CardSelector::DragPage(const float DX) {
+	this->SwipeDir = (DX > 0.0f);
+	this->Dragging = (this->SwipeDir ? this->Page > 0 : this->CanGoNext()); // Only, if there's a page on that side.
+
+	this->Cubic = (this->Dragging ? std::min(std::fabs(DX) * 1.25f, 400.0f) : 0.0f);
+	this->MovePages();
+	GFX::Invalidate();
+}
+
+
+/*
+	Lets the pages go after a drag.
+	A swipe or flick finishes the page switch from where the finger left it, otherwise the pages move back.
+
+	const bool Switch: If it should switch the page.
+*/
+void CardSelector::DropPage(const bool Switch) {
+	if (!this->Dragging) return;
+
+	this->Dragging = false;
+	if (Switch) this->DoSwipe = true;
+	else this->SwipeBack = true;
+}
+
+
 /* Give the OK state. */
 void CardSelector::OK() { this->Done = true; }
 
 
 /* Return, if a next page is available. */
-bool CardSelector::CanGoNext() const {
-	return (((this->Page * 9) + 9) < this->Cards.size());
-}
+bool CardSelector::CanGoNext() const { return this->CardGrid.HasPage(this->Page + 1); }
 
 
 /* Handle Page Switches + Fades. */
 void CardSelector::PageFadeHandler() {
-	hidScanInput();
-	const uint32_t Down = hidKeysDown();
-	const uint32_t Repeat = hidKeysDownRepeat();
+	Input::Scan();
+	const uint32_t Repeat = Input::Repeat();
 
 	/* Fade-In Handler. */
 	if (this->FadeIn) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0, this->FadeIn = false;
 
 		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
+			this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 			if (this->FAlpha <= 0) this->FadeIn = false;
 		}
 	}
 
-	/* Fade-Out Handler. */
-	if (this->Done) {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FullDone = true;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FullDone = true;
-		}
-	}
-
 	/* Initial Swipe. */
 	if (this->InitialSwipe) {
 		if (!_3DZwei::CFG->DoAnimation()) {
@@ -127,7 +156,7 @@ void CardSelector::PageFadeHandler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 			this->CurPos = -400 + this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -143,6 +172,8 @@ void CardSelector::PageFadeHandler() {
 	/* Page Swipe Handler. */
 	if (this->DoSwipe) {
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
+			if (Repeat & KEY_TOUCH) this->Touch.Cancel(); // The touch only skipped the swipe.
+
 			this->CurPos = 0.0f, this->PrevPos = -400.0f, this->NextPos = 400.0f;
 			this->Cubic = 0.0f;
 			this->DoSwipe = false;
@@ -152,16 +183,8 @@ void CardSelector::PageFadeHandler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
-
-			if (this->SwipeDir) { // -> (Last).
-				this->CurPos = this->Cubic;
-				this->PrevPos = -400 + this->Cubic;
-
-			} else { // <- (Next).
-				this->CurPos = 0 - this->Cubic;
-				this->NextPos = 400 - this->Cubic;
-			}
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
+			this->MovePages();
 
 			if (this->Cubic >= 400.0f) {
 				this->CurPos = 0.0f, this->PrevPos = -400.0f, this->NextPos = 400.0f;
@@ -173,42 +196,47 @@ void CardSelector::PageFadeHandler() {
 			}
 		}
 	}
+
+	/* Page Move Back after a drag. */
+	if (this->SwipeBack) {
+		this->Cubic = Clock::Lerp(this->Cubic, -1.0f, 0.3f);
+		if (!_3DZwei::CFG->DoAnimation() || this->Cubic <= 0.0f) this->Cubic = 0.0f, this->SwipeBack = false;
+
+		this->MovePages();
+	}
+}
+
+
+/*
+	Draws a page of cards with their checkboxes. Cards, which are swiped out of the screen, are skipped.
+
+	const size_t Pg: The page to draw.
+	const int AddOffs: The offset of the page for swipes.
+*/
+void CardSelector::DrawPage(const size_t Pg, const int AddOffs) {
+	this->CardGrid.Draw(Pg, AddOffs, 0, [this](const size_t Idx, const size_t Slot, const float X, const float Y) {
+		this->Batch.Add(Idx, X, Y);
+	});
+	this->Batch.Draw();
+
+	this->BoxGrid.Draw(Pg, AddOffs, 0, [this](const size_t Idx, const size_t Slot, const float X, const float Y) {
+		GFX::DrawCheckbox(X, Y, this->Cards[Idx]);
+	});
 }
 
 
 /* Draw the top. */
 void CardSelector::DrawTop() {
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("CARD_SELECTOR_TITLE"), 395);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CARD_SELECTOR_TITLE), 395);
 
-	/* Current Page. */
-	if (this->DoSwipe || this->InitialSwipe) {
-		for (size_t Idx = (this->Page * 9), Idx2 = 0; Idx < (this->Page * 9) + 9 && Idx < this->Cards.size(); Idx++, Idx2++) {
-			Gui::DrawSprite(GFX::Cards, Idx, this->Positions[Idx2 + 2].X + this->CurPos, this->Positions[Idx2 + 2].Y);
-			GFX::DrawCheckbox(this->Positions[Idx2 + 11].X + this->CurPos, this->Positions[Idx2 + 11].Y, this->Cards[Idx]);
-		}
-
-		/* Prev Page. */
-		if (this->Page >= 1) {
-			for (size_t Idx = ((this->Page - 1) * 9), Idx2 = 0; Idx < ((this->Page - 1) * 9) + 9 && Idx < this->Cards.size(); Idx++, Idx2++) {
-				Gui::DrawSprite(GFX::Cards, Idx, this->Positions[Idx2 + 2].X + this->PrevPos, this->Positions[Idx2 + 2].Y);
-				GFX::DrawCheckbox(this->Positions[Idx2 + 11].X + this->PrevPos, this->Positions[Idx2 + 11].Y, this->Cards[Idx]);
-			}
-		}
-
-		/* Next Page. */
-		if (this->CanGoNext()) {
-			for (size_t Idx = ((this->Page + 1) * 9), Idx2 = 0; Idx < ((this->Page + 1) * 9) + 9 && Idx < this->Cards.size(); Idx++, Idx2++) {
-				Gui::DrawSprite(GFX::Cards, Idx, this->Positions[Idx2 + 2].X + this->NextPos, this->Positions[Idx2 + 2].Y);
-				GFX::DrawCheckbox(this->Positions[Idx2 + 11].X + this->NextPos, this->Positions[Idx2 + 11].Y, this->Cards[Idx]);
-			}
-		}
+	if (this->DoSwipe || this->InitialSwipe || this->Dragging || this->SwipeBack) {
+		this->DrawPage(this->Page, this->CurPos); // Current Page.
+		if (this->Page >= 1) this->DrawPage(this->Page - 1, this->PrevPos); // Prev Page.
+		this->DrawPage(this->Page + 1, this->NextPos); // Next Page.
 
 	} else { // No switch in progress, display normally.
-		for (size_t Idx = (this->Page * 9), Idx2 = 0; Idx < (this->Page * 9) + 9 && Idx < this->Cards.size(); Idx++, Idx2++) {
-			Gui::DrawSprite(GFX::Cards, Idx, this->Positions[Idx2 + 2].X, this->Positions[Idx2 + 2].Y);
-			GFX::DrawCheckbox(this->Positions[Idx2 + 11].X, this->Positions[Idx2 + 11].Y, this->Cards[Idx]);
-		}
+		this->DrawPage(this->Page, 0);
 	}
 
 	GFX::DrawCornerEdge(true, this->Positions[0].X, this->Positions[0].Y, this->Positions[0].H, this->Page > 0);
@@ -230,18 +258,18 @@ void CardSelector::DrawBottom() {
 	GFX::DrawCornerEdge(false, this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].H, this->CanGoNext());
 
 	/* Draw the Checkboxes. */
-	for (size_t Idx = (this->Page * 9), Idx2 = 0; Idx < (this->Page * 9) + 9 && Idx < this->Cards.size(); Idx++, Idx2++) {
-		GFX::DrawCheckbox(this->BottomPos[Idx2 + 2].X, this->BottomPos[Idx2 + 2].Y, this->Cards[Idx]);
-	}
+	this->BottomGrid.Draw(this->Page, 0, 0, [this](const size_t Idx, const size_t Slot, const float X, const float Y) {
+		GFX::DrawCheckbox(X, Y, this->Cards[Idx]);
+	});
 
 	Gui::Draw_Rect(this->BottomPos[11].X, this->BottomPos[11].Y, this->BottomPos[11].W, this->BottomPos[11].H, BAR_BLUE);
-	Gui::DrawStringCentered(0, this->BottomPos[11].Y + 3, 0.6f, TEXT_WHITE, Lang::Get("OK"));
+	GFX::DrawStringCentered(0, this->BottomPos[11].Y + 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::OK));
 
 	/* Select All / Deselect All. */
 	Gui::Draw_Rect(this->BottomPos[12].X, this->BottomPos[12].Y, this->BottomPos[12].W, this->BottomPos[12].H, BAR_BLUE);
-	Gui::DrawStringCentered(-60, this->BottomPos[12].Y + 5, 0.5f, TEXT_WHITE, Lang::Get("SELECT_ALL"), 100);
+	GFX::DrawStringCentered(-60, this->BottomPos[12].Y + 5, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::SELECT_ALL), 100);
 	Gui::Draw_Rect(this->BottomPos[13].X, this->BottomPos[13].Y, this->BottomPos[13].W, this->BottomPos[13].H, BAR_BLUE);
-	Gui::DrawStringCentered(60, this->BottomPos[13].Y + 5, 0.5f, TEXT_WHITE, Lang::Get("DESELECT_ALL"), 100);
+	GFX::DrawStringCentered(60, this->BottomPos[13].Y + 5, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::DESELECT_ALL), 100);
 
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
 		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
@@ -251,26 +279,26 @@ void CardSelector::DrawBottom() {
 
 /* Main Action Logic. */
 void CardSelector::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	Pointer::OnTop = true;
 	Pointer::SetPos(0, 0);
 
-	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		this->DrawBottom();
-		C3D_FrameEnd(0);
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->DrawTop();
+			this->DrawBottom();
+			GFX::EndFrame();
+		}
 
-		if (this->FadeIn || this->Done || this->DoSwipe || this->InitialSwipe) this->PageFadeHandler();
+		if (this->FadeIn || this->DoSwipe || this->InitialSwipe || this->SwipeBack) this->PageFadeHandler();
 		else {
-			hidScanInput();
+			Input::Scan();
 			touchPosition T;
-			hidTouchRead(&T);
-			const uint32_t Down = hidKeysDown();
-			const uint32_t Held = hidKeysHeld();
-			const uint32_t Repeat = hidKeysDownRepeat();
+			Input::TouchRead(&T);
+			const uint32_t Down = Input::Down();
+			const uint32_t Held = Input::Held();
+			const uint32_t Repeat = Input::Repeat();
 			Pointer::ScrollHandling(Held);
 
 			if (Repeat & KEY_L) this->PrevPage();
@@ -279,22 +307,47 @@ void CardSelector::Action() {
 			if (Down & KEY_Y) this->SelectAll();
 			if (Down & KEY_X) this->SelectNone();
 
-			if (Repeat & KEY_A) {
-				for (auto &Position : this->Positions) {
-					if (Pointer::Clicked(Position, true)) break;
-				}
-			}
+			if (Repeat & KEY_A) this->PositionsIndex.Clicked();
 
-			if (Repeat & KEY_TOUCH) {
-				for (auto &Position : this->BottomPos) {
-					if (Touched(Position, T, true)) break;
+			switch(this->Touch.Update(Held, T)) {
+				case Gesture::Type::Press: { // Buttons off the page don't wait for a tap.
+					const int Hit = this->BottomPosIndex.Find(T.px, T.py);
+
+					if (Hit >= 0 && !this->BottomGrid.Contains(Hit)) {
+						this->BottomPos[Hit].Func();
+						this->Touch.Cancel();
+					}
+					break;
 				}
+
+				case Gesture::Type::LongPress: // A finger held still won't drag anymore.
+				case Gesture::Type::Tap: // Only a tap toggles, so a drag can start on a checkbox.
+					this->BottomPosIndex.Touched(this->Touch.Start());
+					break;
+
+				case Gesture::Type::Drag:
+					this->DragPage(this->Touch.DX());
+					break;
+
+				case Gesture::Type::Swipe:
+				case Gesture::Type::Flick:
+					this->DropPage(true);
+					break;
+
+				case Gesture::Type::Release:
+					this->DropPage(false);
+					break;
+
+				default:
+					break;
 			}
 
 			if (Down & KEY_START) this->OK();
 		}
 	}
 
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->DrawTop(); this->DrawBottom(); }, true);
+
 	/* Set the cards now, that we finished. */
 	if (this->Changed) {
 		Utils::Cards.clear();
@@ -27,10 +27,10 @@
 #include "Browser.hpp"
 #include "CardSetSelector.hpp"
 #include "Common.hpp"
+#include "Transition.hpp" // Fade-Out.
 #include "Utils.hpp"
 
 #define SETS_PER_SCREEN  5
-#define CARDS_PER_SCREEN 9
 
 
 CardSetSelector::CardSetSelector() {
@@ -80,15 +80,17 @@ void CardSetSelector::PreviewSelection(const size_t Idx, const bool SetSelection
 		}
 
 		if (this->SetGood) {
-			/* Re-Load them. */
-			if (C2D_SpriteSheetCount(this->PreviewSheet) > 1) { // Make sure there are at least 2 cards.
-				for (size_t Idx = 0; Idx < C2D_SpriteSheetCount(this->PreviewSheet) - 1; Idx++) {
-					this->CardScale.push_back(1.0f);
-					this->CardFlipped.push_back(true);
-				}
+			/* Re-Load them. The last sprite is the back cover. */
+			const size_t Cards = C2D_SpriteSheetCount(this->PreviewSheet);
+
+			if (Cards > 1) { // Make sure there are at least 2 cards.
+				this->CardScale.assign(Cards - 1, 1.0f);
+				this->CardFlipped.assign(Cards - 1, true);
 			}
 		}
 
+		this->CardGrid.Resize(this->CardFlipped.size()), this->BottomGrid.Resize(this->CardFlipped.size());
+
 		/* Swipe new selected cardset in. */
 		this->CurCardPos = -400;
 		this->CardSwipeIn = true;
@@ -102,20 +104,24 @@ void CardSetSelector::PreviewSelection(const size_t Idx, const bool SetSelection
 void CardSetSelector::OldCardsetOut() {
 	bool Done = false;
 	this->CardSwipeOut = true;
+	Input::Flush(); // The press, that selected the set, doesn't skip the swipe.
 
 	while(aptMainLoop() && !Done) {
-		this->Draw();
+		if (GFX::BeginFrame()) {
+			this->Draw();
+			GFX::EndFrame();
+		}
 
-		hidScanInput();
-		const uint32_t Repeat = hidKeysDownRepeat();
+		Input::Scan();
+		Input::Event E;
 
-		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
+		if (!_3DZwei::CFG->DoAnimation() || Input::Poll(E)) {
 			this->CardSwipeOut = false, this->CurCardPos = 0, this->Cubic = 0.0f;
 			return;
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.3f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.3f);
 			this->CurCardPos = 0 - this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -129,8 +135,10 @@ void CardSetSelector::OldCardsetOut() {
 
 /* Toggle the specified indexed card. */
 void CardSetSelector::ToggleCard(const uint8_t Idx) {
-	if (((this->CardPage * CARDS_PER_SCREEN) + Idx) < (int)this->CardFlipped.size()) {
-		this->ToFlip = (this->CardPage * CARDS_PER_SCREEN) + Idx;
+	const int Card = this->CardGrid.Index(this->CardPage, Idx);
+
+	if (Card >= 0) {
+		this->ToFlip = Card;
 		this->FlipCard = true;
 	}
 }
@@ -138,7 +146,7 @@ void CardSetSelector::ToggleCard(const uint8_t Idx) {
 
 /* Go to the previous card page. */
 void CardSetSelector::PrevCardPage() {
-	if (this->CardPage > 0) {
+	if (this->CardPage > 0 && !this->CardDrag) {
 		this->CardSwipeDir = true;
 		this->CardSwipe = true;
 	}
@@ -168,7 +176,7 @@ void CardSetSelector::PrevSetPage() {
 
 /* Go to the next card page. */
 void CardSetSelector::NextCardPage() {
-	if (this->CardCanGoNext()) {
+	if (this->CardCanGoNext() && !this->CardDrag) {
 		this->CardSwipeDir = false;
 		this->CardSwipe = true;
 	}
@@ -196,12 +204,48 @@ void CardSetSelector::NextSetPage() {
 }
 
 
-/* Return, if a next card page is available. */
-bool CardSetSelector::CardCanGoNext() const {
-	return (((this->CardPage * CARDS_PER_SCREEN) + CARDS_PER_SCREEN) < (int)this->CardFlipped.size());
+/* Moves the current card page and the one in swipe direction by Cubic. */
+void CardSetSelector::MoveCardPages() {
+	this->CurCardPos = (this->CardSwipeDir ? this->Cubic : 0 - this->Cubic);
+	this->PrevCardPos = -400 + (this->CardSwipeDir ? this->Cubic : 0.0f); // -> (Last).
+	this->NextCardPos = 400 - (this->CardSwipeDir ? 0.0f : this->Cubic); // <- (Next).
+}
+
+
+/*
+	Moves the card pages with the finger. The drag on the touch screen is scaled to the wider top screen.
+
+	const float DX: The horizontal distance of the drag.
+*/
+void CardSetSelector::DragCardPage(const float DX) {
+	this->CardSwipeDir = (DX > 0.0f);
+	this->CardDrag = (this->CardSwipeDir ? this->CardPage > 0 : this->CardCanGoNext()); // Only, if there's a page on that side.
+
+	this->Cubic = (this->CardDrag ? std::min(std::fabs(DX) * 1.25f, 400.0f) : 0.0f);
+	this->MoveCardPages();
+	GFX::Invalidate();
 }
 
 
+/*
+	Lets the card pages go after a drag.
+	A swipe or flick finishes the page switch from where the finger left it, otherwise the pages move back.
+
+	const bool Switch: If it should switch the page.
+*/
+void CardSetSelector::DropCardPage(const bool Switch) {
+	if (!this->CardDrag) return;
+
+	this->CardDrag = false;
+	if (Switch) this->CardSwipe = true;
+	else this->CardSwipeBack = true;
+}
+
+
+/* Return, if a next card page is available. */
+bool CardSetSelector::CardCanGoNext() const { return this->CardGrid.HasPage(this->CardPage + 1); }
+
+
 void CardSetSelector::Cancel() { this->IsSelecting = true, this->ModeSwitch = true; }
 void CardSetSelector::Confirm() { this->Res = true, this->Done = true; }
 
@@ -213,18 +257,15 @@ void CardSetSelector::Confirm() { this->Res = true, this->Done = true; }
 	const int AddOffs: The Offsets to add to the base position.
 */
 void CardSetSelector::DrawCardPage(const size_t Pg, const int AddOffs) {
-	if (this->SetGood) { // Ensure set is good.
-		if ((Pg * CARDS_PER_SCREEN) < this->CardFlipped.size()) {
-			for (size_t Idx = (Pg * CARDS_PER_SCREEN), Idx2 = 0; Idx < (Pg * CARDS_PER_SCREEN) + CARDS_PER_SCREEN && Idx < this->CardFlipped.size(); Idx++, Idx2++) {
-				if (this->CardFlipped[Idx]) {
-					Gui::DrawSprite(this->PreviewSheet, Idx, this->Positions[Idx2 + 2].X + (1.0f - this->CardScale[Idx]) * 55 / 2 + AddOffs, this->Positions[Idx2 + 2].Y, this->CardScale[Idx], 1.0f);
-
-				} else {
-					Gui::DrawSprite(this->PreviewSheet, this->CardFlipped.size(), this->Positions[Idx2 + 2].X + (1.0f - this->CardScale[Idx]) * 55 / 2 + AddOffs, this->Positions[Idx2 + 2].Y, this->CardScale[Idx], 1.0f);
-				}
-			}
-		}
-	}
+	if (!this->SetGood) return; // Ensure set is good.
+
+	this->CardGrid.Draw(Pg, AddOffs, 0, [this](const size_t Idx, const size_t Slot, const float X, const float Y) {
+		const float FlipX = X + (1.0f - this->CardScale[Idx]) * 55 / 2;
+
+		if (this->CardFlipped[Idx]) this->Batch.Add(Idx, FlipX, Y, this->CardScale[Idx], 1.0f); // The card or the back cover.
+		else this->Batch.AddBack(FlipX, Y, this->CardScale[Idx], 1.0f);
+	});
+	this->Batch.Draw(this->PreviewSheet);
 }
 
 
@@ -236,7 +277,7 @@ void CardSetSelector::DrawCardPage(const size_t Pg, const int AddOffs) {
 void CardSetSelector::DrawSetList(const int AddOffs) {
 	for(size_t Idx = 0; Idx < SETS_PER_SCREEN && Idx < this->CardSets.size(); Idx++) {
 		Gui::Draw_Rect(this->SetPos[1 + Idx].X + AddOffs, this->SetPos[1 + Idx].Y, this->SetPos[1 + Idx].W, this->SetPos[1 + Idx].H, BAR_BLUE);
-		Gui::DrawStringCentered(0 + AddOffs, this->SetPos[1 + Idx].Y + 8, 0.45f, TEXT_WHITE, this->CardSets[this->SetListPos + Idx], 160);
+		GFX::DrawStringCentered(0 + AddOffs, this->SetPos[1 + Idx].Y + 8, 0.45f, TEXT_WHITE, this->CardSets[this->SetListPos + Idx], 160);
 		GFX::DrawCheckbox(this->SetPos[Idx + 1].X + 194 + AddOffs, this->SetPos[Idx + 1].Y + 4, (this->SetListPos + (int)Idx == this->SelectedSet), true);
 	}
 
@@ -251,18 +292,18 @@ void CardSetSelector::DrawSetList(const int AddOffs) {
 	const int AddOffs: The Offsets to add to the base position.
 */
 void CardSetSelector::DrawCardBottom(const int AddOffs) {
-	Gui::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get("AMOUNT_OF_CARDS") + std::to_string(this->CardFlipped.size()) , 310);
+	GFX::DrawStringCentered(0 + AddOffs, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::AMOUNT_OF_CARDS) + std::to_string(this->CardFlipped.size()) , 310);
 
 	/* Draw Cancel and Confirm buttons. */
 	Gui::Draw_Rect(this->BottomPos[11].X + AddOffs, this->BottomPos[11].Y, this->BottomPos[11].W, this->BottomPos[11].H, BAR_BLUE);
-	Gui::DrawStringCentered(-60 + AddOffs, this->BottomPos[11].Y + 3, 0.6f, TEXT_WHITE, Lang::Get("CANCEL"), 100);
+	GFX::DrawStringCentered(-60 + AddOffs, this->BottomPos[11].Y + 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CANCEL), 100);
 	Gui::Draw_Rect(this->BottomPos[12].X + AddOffs, this->BottomPos[12].Y, this->BottomPos[12].W, this->BottomPos[12].H, BAR_BLUE);
-	Gui::DrawStringCentered(60 + AddOffs, this->BottomPos[12].Y + 3, 0.6f, TEXT_WHITE, Lang::Get("CONFIRM"), 100);
+	GFX::DrawStringCentered(60 + AddOffs, this->BottomPos[12].Y + 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CONFIRM), 100);
 
 	/* Draw the Checkboxes for toggling the back cover. */
-	for (size_t Idx = (this->CardPage * CARDS_PER_SCREEN), Idx2 = 0; Idx < ((size_t)this->CardPage * CARDS_PER_SCREEN) + CARDS_PER_SCREEN && Idx < this->CardFlipped.size(); Idx++, Idx2++) {
-		GFX::DrawCheckbox(this->BottomPos[Idx2 + 2].X + AddOffs, this->BottomPos[Idx2 + 2].Y, this->CardFlipped[Idx]);
-	}
+	this->BottomGrid.Draw(this->CardPage, AddOffs, 0, [this](const size_t Idx, const size_t Slot, const float X, const float Y) {
+		GFX::DrawCheckbox(X, Y, this->CardFlipped[Idx]);
+	});
 
 	GFX::DrawCornerEdge(true, this->BottomPos[0].X + AddOffs, this->BottomPos[0].Y, this->BottomPos[0].H, this->CardPage > 0);
 	GFX::DrawCornerEdge(false, this->BottomPos[1].X + AddOffs, this->BottomPos[1].Y, this->BottomPos[1].H, this->CardCanGoNext());
@@ -270,18 +311,14 @@ void CardSetSelector::DrawCardBottom(const int AddOffs) {
 
 
 /*
-	The Main Draw handle.
+	The Main Draw handle. Draws both screens, with the fade.
 */
 void CardSetSelector::Draw() {
-	Gui::clearTextBufs();
-	C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-	C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
 	GFX::DrawTop();
 
 	/* Top bar text. */
-	if (this->IsSelecting) Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("CARDSET_SELECTOR_TITLE"), 395);
-	else Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("CARDSET_SELECTOR_CONFIRM"), 395);
+	if (this->IsSelecting) GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CARDSET_SELECTOR_TITLE), 395);
+	else GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CARDSET_SELECTOR_CONFIRM), 395);
 
 	/* Display Preview of the current set. */
 	if (this->SetGood) {
@@ -289,7 +326,7 @@ void CardSetSelector::Draw() {
 			this->DrawCardPage(this->CardPage, this->CurCardPos);
 		}
 
-		if (this->CardSwipe) { // We swipe.
+		if (this->CardSwipe || this->CardDrag || this->CardSwipeBack) { // We swipe.
 			this->DrawCardPage(this->CardPage, this->CurCardPos); // Draw current page.
 
 			if (this->CardSwipeDir) this->DrawCardPage(this->CardPage - 1, this->PrevCardPos);
@@ -339,22 +376,28 @@ void CardSetSelector::Draw() {
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
 		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
 	}
-
-	C3D_FrameEnd(0);
 }
 
 
 /* Main Action. */
 std::string CardSetSelector::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	this->PreviewSelection(0, false, true); // Preview 3DZwei-ROMFS Set.
 	Pointer::OnTop = true;
 	Pointer::SetPos(0, 0);
 
-	while(aptMainLoop() && !this->FullDone) {
-		this->Draw();
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw();
+			GFX::EndFrame();
+		}
+
 		this->Handler();
 	}
 
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(); }, true);
+
 	if (this->SetGood) {
 		if (this->PreviewSheet) C2D_SpriteSheetFree(this->PreviewSheet); // We don't need the Preview anymore, so free the Spritesheet.
 	}
@@ -369,11 +412,12 @@ std::string CardSetSelector::Action() {
 /*
 	Handle the Set Overlay Logic.
 
-	const uint32_t Down: The hidKeysDown() variable.
-	const uint32_t Held: The hidKeysHeld() variable.
+	const uint32_t Down: The Input::Down() variable.
+	const uint32_t Held: The Input::Held() variable.
 	const touchPosition &T: A reference to the touchPosition variable.
 */
 void CardSetSelector::HandleSet(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition &T) {
+	this->Touch.Cancel(); // A touch on the set list doesn't go on as a gesture in the card view.
 	if (Down & KEY_B) this->Done = true; // Exit completely.
 	Pointer::ScrollHandling(Held, true); // Only Circle-Pad.
 
@@ -403,9 +447,7 @@ void CardSetSelector::HandleSet(const uint32_t Down, const uint32_t Held, const
 
 	if (Repeat & KEY_A) {
 		if (Pointer::Show) { // Pointer show -> Handle top.
-			for (auto &Pos : this->Positions) {
-				if (Pointer::Clicked(Pos, true)) break;
-			}
+			this->PositionsIndex.Clicked();
 
 		} else { // Since the pointer is not shown -> Straight go into preview, if good.
 			if (this->SetGood) {
@@ -415,11 +457,7 @@ void CardSetSelector::HandleSet(const uint32_t Down, const uint32_t Held, const
 		}
 	}
 
-	if (Repeat & KEY_TOUCH) {
-		for (auto &Pos : this->SetPos) {
-			if (Touched(Pos, T, true)) break;
-		}
-	}
+	if (Repeat & KEY_TOUCH) this->SetPosIndex.Touched(T);
 
 	/* Scroll. */
 	if (this->SelectedSet < this->SetListPos) this->SetListPos = this->SelectedSet;
@@ -430,12 +468,12 @@ void CardSetSelector::HandleSet(const uint32_t Down, const uint32_t Held, const
 /*
 	Handle the Card Overlay Logic.
 
-	const uint32_t Down: The hidKeysDown() variable.
-	const uint32_t Held: The hidKeysHeld() variable.
+	const uint32_t Down: The Input::Down() variable.
+	const uint32_t Held: The Input::Held() variable.
 	const touchPosition &T: A reference to the touchPosition variable.
 */
 void CardSetSelector::HandleCard(const uint32_t Down, const uint32_t Held, const uint32_t Repeat, const touchPosition &T) {
-	if (Down & KEY_B || Repeat & KEY_DLEFT) this->Cancel(); // Return to set selector.
+	if ((Down & KEY_B || Repeat & KEY_DLEFT) && !this->CardDrag) this->Cancel(); // Return to set selector.
 	Pointer::ScrollHandling(Held, true); // Only with the Circle-Pad.
 
 	if (Repeat & KEY_L) this->PrevCardPage();
@@ -445,35 +483,58 @@ void CardSetSelector::HandleCard(const uint32_t Down, const uint32_t Held, const
 		if (this->SetGood) this->Confirm();
 	}
 
-	if (Repeat & KEY_A) {
-		for (auto &Pos : this->Positions) {
-			if (Pointer::Clicked(Pos, true)) break;
-		}
-	}
+	if (Repeat & KEY_A) this->PositionsIndex.Clicked();
+
+	switch(this->Touch.Update(Held, T)) {
+		case Gesture::Type::Press: { // Buttons off the page don't wait for a tap.
+			const int Hit = this->BottomPosIndex.Find(T.px, T.py);
 
-	if (Repeat & KEY_TOUCH) {
-		for (auto &Pos : this->BottomPos) {
-			if (Touched(Pos, T, true)) break;
+			if (Hit >= 0 && !this->BottomGrid.Contains(Hit)) {
+				this->BottomPos[Hit].Func();
+				this->Touch.Cancel();
+			}
+			break;
 		}
+
+		case Gesture::Type::LongPress: // A finger held still won't drag anymore.
+		case Gesture::Type::Tap: // Only a tap flips, so a drag can start on a checkbox.
+			this->BottomPosIndex.Touched(this->Touch.Start());
+			break;
+
+		case Gesture::Type::Drag:
+			this->DragCardPage(this->Touch.DX());
+			break;
+
+		case Gesture::Type::Swipe:
+		case Gesture::Type::Flick:
+			this->DropCardPage(true);
+			break;
+
+		case Gesture::Type::Release:
+			this->DropCardPage(false);
+			break;
+
+		default:
+			break;
 	}
 }
 
 
 /* Handles Effects such as fade and that stuff. */
 void CardSetSelector::Handler() {
-	hidScanInput();
+	Input::Scan();
 	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Down = hidKeysDown();
-	const uint32_t Held = hidKeysHeld();
-	const uint32_t Repeat = hidKeysDownRepeat();
+	Input::TouchRead(&T);
+	const uint32_t Down = Input::Down();
+	const uint32_t Held = Input::Held();
+	const uint32_t Repeat = Input::Repeat();
 
 	/* Handle FADE-INs. */
 	if (this->FadeIn) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0, this->FadeIn = false;
 
 		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
+			this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 			if (this->FAlpha <= 0) this->FadeIn = false;
 		}
@@ -487,7 +548,7 @@ void CardSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 320.0f) {
-			this->Cubic = std::lerp(this->Cubic, 321.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.2f);
 			this->CurSetPos = -320 + this->Cubic;
 
 			if (this->Cubic >= 320.0f) {
@@ -506,7 +567,7 @@ void CardSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 			this->CurCardPos = -400 + this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -517,19 +578,6 @@ void CardSetSelector::Handler() {
 		return;
 	}
 
-	/* Handle FADE-OUTs. */
-	if (this->Done) {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FullDone = true;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FullDone = true;
-		}
-
-		return;
-	}
-
 	/* Handle Mode SWIPEs. */
 	if (this->ModeSwitch) {
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
@@ -538,7 +586,7 @@ void CardSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 320.0f) {
-			this->Cubic = std::lerp(this->Cubic, 321.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.2f);
 
 			if (this->Cubic >= 320.0f) this->Cubic = 0.0f, this->ModeSwitch = false;
 		}
@@ -550,7 +598,7 @@ void CardSetSelector::Handler() {
 	if (this->FlipCard && (this->ToFlip != -1) && (this->ToFlip <= (int)this->CardFlipped.size())) { // Focus on card flip.
 		if (!this->FirstFlipDone) { // Scale down the back cover -- first operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 				this->CardScale[this->ToFlip] = 1.0f - this->Cubic;
 
 				if (this->Cubic >= 1.0f) {
@@ -562,7 +610,7 @@ void CardSetSelector::Handler() {
 
 		} else { // Scale up the front cover -- second operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 				this->CardScale[this->ToFlip] = this->Cubic;
 
 				if (this->Cubic >= 1.0f) {
@@ -578,6 +626,8 @@ void CardSetSelector::Handler() {
 	/* Handle CARD SWIPEs. */
 	if (this->CardSwipe) {
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
+			if (Repeat & KEY_TOUCH) this->Touch.Cancel(); // The touch only skipped the swipe.
+
 			this->CurCardPos = 0.0f, this->PrevCardPos = -400.0f, this->NextCardPos = 400.0f;
 			this->Cubic = 0.0f, this->CardSwipe = false;
 			this->CardPage = (this->CardSwipeDir ? (this->CardPage - 1) : (this->CardPage + 1));
@@ -585,10 +635,8 @@ void CardSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
-
-			if (this->CardSwipeDir) this->CurCardPos = this->Cubic, this->PrevCardPos = -400 + this->Cubic; // -> (Last).
-			else this->CurCardPos = 0 - this->Cubic, this->NextCardPos = 400 - this->Cubic; // <- (Next).
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
+			this->MoveCardPages();
 
 			if (this->Cubic >= 400.0f) {
 				this->CurCardPos = 0.0f, this->PrevCardPos = -400.0f, this->NextCardPos = 400.0f;
@@ -600,6 +648,15 @@ void CardSetSelector::Handler() {
 		return;
 	}
 
+	/* Handle CARD SWIPE BACKs after a drag. */
+	if (this->CardSwipeBack) {
+		this->Cubic = Clock::Lerp(this->Cubic, -1.0f, 0.3f);
+		if (!_3DZwei::CFG->DoAnimation() || this->Cubic <= 0.0f) this->Cubic = 0.0f, this->CardSwipeBack = false;
+
+		this->MoveCardPages();
+		return;
+	}
+
 	if (this->IsSelecting) this->HandleSet(Down, Held, Repeat, T);
 	else this->HandleCard(Down, Held, Repeat, T);
 }
\ No newline at end of file
@@ -26,21 +26,44 @@
 
 #include "Common.hpp"
 #include "CharacterSelector.hpp"
+#include "Transition.hpp" // Fade-Out.
 #include "Utils.hpp"
 
 #define CHARS_PER_PAGE 15
 
 
 /*
-	Draw a page of 15 characters.
+	Builds a page node with 15 characters, if it doesn't show that page already.
 
-	const size_t Page: The page to draw.
-	const int AddOffs: The additional offsets to draw to.
+	const uint8_t Node: The page node (0: Current page, 1: Swipe target).
+	const size_t Page: The page to build.
 */
-void CharacterSelector::DrawPage(const size_t Page, const int AddOffs) {
+void CharacterSelector::BuildPage(const uint8_t Node, const size_t Page) {
+	if (this->BuiltPages[Node] == Page) return;
+
+	this->Pages.Clear(this->PageNodes[Node]);
+	this->BuiltPages[Node] = Page;
+
 	for (size_t Idx = (Page * CHARS_PER_PAGE), Idx2 = 0; Idx < (Page * CHARS_PER_PAGE) + CHARS_PER_PAGE && Idx < Utils::GetCharSheetSize(); Idx++, Idx2++) {
-		Gui::DrawSprite(GFX::Characters, Idx, this->Characters[Idx2].X + AddOffs, this->Characters[Idx2].Y, 0.4f, 0.4f);
+		this->Pages.Sprite(this->PageNodes[Node], 0, GFX::Characters, Idx, this->Characters[Idx2].X, this->Characters[Idx2].Y, 0.4f, 0.4f);
+	}
+}
+
+
+/* Draws the current page and while swiping the previous or next page. A swipe only moves the page nodes. */
+void CharacterSelector::DrawPages() {
+	const bool Swiping = (this->DoSwipe || this->InitialSwipe || this->Dragging || this->SwipeBack);
+
+	this->BuildPage(0, this->Page);
+	this->Pages.SetPos(this->PageNodes[0], (Swiping ? this->CurPos : 0), 0);
+
+	if (Swiping && !this->InitialSwipe) { // The initial swipe only moves in the current page.
+		this->BuildPage(1, (this->SwipeDir ? this->Page - 1 : this->Page + 1));
+		this->Pages.SetPos(this->PageNodes[1], (this->SwipeDir ? this->PrevPos : this->NextPos), 0);
 	}
+
+	this->Pages.SetVisible(this->PageNodes[1], Swiping && !this->InitialSwipe);
+	this->Pages.Draw();
 }
 
 
@@ -67,7 +90,7 @@ void CharacterSelector::SelectCharacter(const uint8_t Idx) {
 
 /* Go to the previous page. */
 void CharacterSelector::PrevPage() {
-	if (this->Page > 0) {
+	if (this->Page > 0 && !this->Dragging) {
 		this->SwipeDir = true;
 		this->DoSwipe = true;
 	}
@@ -76,13 +99,51 @@ void CharacterSelector::PrevPage() {
 
 /* Go to the next page. */
 void CharacterSelector::NextPage() {
-	if (this->CanGoNext()) {
+	if (this->CanGoNext() && !this->Dragging) {
 		this->SwipeDir = false;
 		this->DoSwipe = true;
 	}
 }
 
 
+/* Moves the current page and the one in swipe direction by Cubic. */
+void CharacterSelector::MovePages() {
+	this->CurPos = (this->SwipeDir ? this->Cubic : 0 - this->Cubic);
+	this->PrevPos = -320 + (this->SwipeDir ? this->Cubic : 0.0f); // -> (Last).
+	this->NextPos = 320 - (this->SwipeDir ? 0.0f : this->Cubic); // <- (Next).
+}
+
+
+/*
+	Moves the pages with the finger.
+
+	const float DX: The horizontal distance of the drag.
+*/
+void CharacterSelector::DragPage(const float DX) {
+	this->SwipeDir = (DX > 0.0f);
+	this->Dragging = (this->SwipeDir ? this->Page > 0 : this->CanGoNext()); // Only, if there's a page on that side.
+
+	this->Cubic = (this->Dragging ? std::min(std::fabs(DX), 320.0f) : 0.0f);
+	this->MovePages();
+	GFX::Invalidate();
+}
+
+
+/*
+	Lets the pages go after a drag.
+	A swipe or flick finishes the page switch from where the finger left it, otherwise the pages move back.
+
+	const bool Switch: If it should switch the page.
+*/
+void CharacterSelector::DropPage(const bool Switch) {
+	if (!this->Dragging) return;
+
+	this->Dragging = false;
+	if (Switch) this->DoSwipe = true;
+	else this->SwipeBack = true;
+}
+
+
 void CharacterSelector::Cancel() { this->Done = true; }
 
 
@@ -92,87 +153,74 @@ bool CharacterSelector::CanGoNext() const {
 }
 
 
-/* Main action. */
-int CharacterSelector::Action() {
-	if (Utils::GetCharSheetSize() == 0) return 0;
+/* Draws both screens, with the fade. */
+void CharacterSelector::Draw() {
+	GFX::DrawTop();
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CHARACTER_SELECT_TITLE), 395);
 
-	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+	if (this->Res < (int)Utils::GetCharSheetSize()) {
+		Gui::DrawSprite(GFX::Characters, this->Res, 100, 40, 1.5f, 1.5f);
+	}
 
-		GFX::DrawTop();
-		Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("CHARACTER_SELECT_TITLE"), 395);
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
 
-		if (this->Res < (int)Utils::GetCharSheetSize()) {
-			Gui::DrawSprite(GFX::Characters, this->Res, 100, 40, 1.5f, 1.5f);
-		}
+	GFX::DrawBottom();
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-		}
+	this->DrawPages();
 
-		GFX::DrawBottom();
+	Gui::DrawSprite(GFX::Sprites, sprites_random_idx, this->Characters[15].X, this->Characters[15].Y);
+	GFX::DrawCornerEdge(true, this->BottomPos[0].X, this->BottomPos[0].Y, this->BottomPos[0].H, this->Page > 0);
+	GFX::DrawCornerEdge(false, this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].H, this->CanGoNext());
+	Pointer::Draw();
 
-		if (this->DoSwipe || this->InitialSwipe) { // We swipe.
-			this->DrawPage(this->Page, this->CurPos); // Draw current page.
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	}
+}
 
-			if (this->SwipeDir) this->DrawPage(this->Page - 1, this->PrevPos);
-			else this->DrawPage(this->Page + 1, this->NextPos);
 
-		} else { // No swipe.
-			this->DrawPage(this->Page, 0); // Draw current page only.
-		}
+/* Main action. */
+int CharacterSelector::Action() {
+	GFX::Invalidate(); // A new screen is shown.
 
-		Gui::DrawSprite(GFX::Sprites, sprites_random_idx, this->Characters[15].X, this->Characters[15].Y);
-		GFX::DrawCornerEdge(true, this->BottomPos[0].X, this->BottomPos[0].Y, this->BottomPos[0].H, this->Page > 0);
-		GFX::DrawCornerEdge(false, this->BottomPos[1].X, this->BottomPos[1].Y, this->BottomPos[1].H, this->CanGoNext());
-		Pointer::Draw();
+	if (Utils::GetCharSheetSize() == 0) return 0;
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw();
+			GFX::EndFrame();
 		}
 
-		C3D_FrameEnd(0);
 		this->Handler();
 	}
 
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(); }, true);
 	return this->Res;
 }
 
 
 /* Action Handler. */
 void CharacterSelector::Handler() {
-	hidScanInput();
+	Input::Scan();
 	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Down = hidKeysDown();
-	const uint32_t Held = hidKeysHeld();
-	const uint32_t Repeat = hidKeysDownRepeat();
+	Input::TouchRead(&T);
+	const uint32_t Down = Input::Down();
+	const uint32_t Held = Input::Held();
+	const uint32_t Repeat = Input::Repeat();
 
 	/* Fade-In Handler. */
 	if (this->FadeIn) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0, this->FadeIn = false;
 
 		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
+			this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 			if (this->FAlpha <= 0) this->FadeIn = false;
 		}
 	}
 
-	/* Fade-Out Handler. */
-	if (this->Done) {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FullDone = true;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FullDone = true;
-		}
-	}
-
 	/* Initial Swipe. */
 	if (this->InitialSwipe) {
 		if (!_3DZwei::CFG->DoAnimation()) {
@@ -181,7 +229,7 @@ void CharacterSelector::Handler() {
 		}
 
 		if (this->Cubic < 320.0f) {
-			this->Cubic = std::lerp(this->Cubic, 321.0f, 0.1f);
+			this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.1f);
 			this->CurPos = -320 + this->Cubic;
 
 			if (this->Cubic >= 320.0f) {
@@ -195,6 +243,8 @@ void CharacterSelector::Handler() {
 	/* Swipe Logic. */
 	if (this->DoSwipe) {
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
+			if (Repeat & KEY_TOUCH) this->Touch.Cancel(); // The touch only skipped the swipe.
+
 			this->CurPos = 0.0f, this->PrevPos = -320.0f, this->NextPos = 320.0f;
 			this->Cubic = 0.0f, this->DoSwipe = false;
 			this->Page = (this->SwipeDir ? (this->Page - 1) : (this->Page + 1));
@@ -202,10 +252,8 @@ void CharacterSelector::Handler() {
 		}
 
 		if (this->Cubic < 320.0f) {
-			this->Cubic = std::lerp(this->Cubic, 321.0f, 0.1f);
-
-			if (this->SwipeDir) this->CurPos = this->Cubic, this->PrevPos = -320 + this->Cubic; // -> (Last).
-			else this->CurPos = 0 - this->Cubic, this->NextPos = 320 - this->Cubic; // <- (Next).
+			this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.1f);
+			this->MovePages();
 
 			if (this->Cubic >= 320.0f) {
 				this->CurPos = 0.0f, this->PrevPos = -320.0f, this->NextPos = 320.0f;
@@ -217,45 +265,50 @@ void CharacterSelector::Handler() {
 		return;
 	}
 
+	/* Page Move Back after a drag. */
+	if (this->SwipeBack) {
+		this->Cubic = Clock::Lerp(this->Cubic, -1.0f, 0.2f);
+		if (!_3DZwei::CFG->DoAnimation() || this->Cubic <= 0.0f) this->Cubic = 0.0f, this->SwipeBack = false;
+
+		this->MovePages();
+		return;
+	}
+
 	Pointer::ScrollHandling(Held);
 	if (Down & KEY_B || Down & KEY_START) this->Cancel();
 	if (Repeat & KEY_L) this->PrevPage();
 	if (Repeat & KEY_R) this->NextPage();
 
 	if (Repeat & KEY_A) {
-		bool Clicked = false;
-		for (auto &Position : this->BottomPos) {
-			if (Pointer::Clicked(Position, true)) {
-				Clicked = true;
-				break;
-			}
-		}
-
-		if (Clicked) return;
+		if (this->BottomPosIndex.Clicked()) return;
 	}
 
-	if (Down & KEY_A) {
-		for (auto &Position : this->Characters) {
-			if (Pointer::Clicked(Position, true)) break;
-		}
-	}
+	if (Down & KEY_A) this->CharactersIndex.Clicked();
 
-	if (Repeat & KEY_TOUCH) {
-		bool Clicked = false;
+	switch(this->Touch.Update(Held, T)) {
+		case Gesture::Type::Press: // The buttons are off the page, so they don't wait for a tap.
+			if (this->BottomPosIndex.Touched(T)) this->Touch.Cancel();
+			break;
 
-		for (auto &Position : this->BottomPos) {
-			if (Touched(Position, T, true)) {
-				Clicked = true;
-				break;
-			}
-		}
+		case Gesture::Type::LongPress: // A finger held still won't drag anymore.
+		case Gesture::Type::Tap: // Only a tap selects, so a drag can start on a character.
+			this->CharactersIndex.Touched(this->Touch.Start());
+			break;
 
-		if (Clicked) return;
-	}
+		case Gesture::Type::Drag:
+			this->DragPage(this->Touch.DX());
+			break;
 
-	if (Down & KEY_TOUCH) {
-		for (auto &Position : this->Characters) {
-			if (Touched(Position, T, true)) break;
-		}
+		case Gesture::Type::Swipe:
+		case Gesture::Type::Flick:
+			this->DropPage(true);
+			break;
+
+		case Gesture::Type::Release:
+			this->DropPage(false);
+			break;
+
+		default:
+			break;
 	}
 }
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include "Browser.hpp"
 #include "CharacterSetSelector.hpp"
 #include "Common.hpp"
+#include "Transition.hpp" // Fade-Out.
 #include "Utils.hpp"
 
 #define SETS_PER_SCREEN 5
@@ -91,10 +92,13 @@ void CharacterSetSelector::OldCharsetOut() {
 	this->CharSwipeOut = true;
 
 	while(aptMainLoop() && !Done) {
-		this->Draw();
+		if (GFX::BeginFrame()) {
+			this->Draw();
+			GFX::EndFrame();
+		}
 
-		hidScanInput();
-		const uint32_t Repeat = hidKeysDownRepeat();
+		Input::Scan();
+		const uint32_t Repeat = Input::Repeat();
 
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
 			this->CharSwipeOut = false, this->CurPos = 0, this->Cubic = 0.0f;
@@ -102,7 +106,7 @@ void CharacterSetSelector::OldCharsetOut() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 			this->CurPos = 0 - this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -213,7 +217,7 @@ void CharacterSetSelector::DrawCharacter(const int Page, const int AddOffs) {
 void CharacterSetSelector::DrawSetList(const int AddOffs) {
 	for(size_t Idx = 0; Idx < SETS_PER_SCREEN && Idx < this->CharSets.size(); Idx++) {
 		Gui::Draw_Rect(this->SetPos[1 + Idx].X + AddOffs, this->SetPos[1 + Idx].Y, this->SetPos[1 + Idx].W, this->SetPos[1 + Idx].H, BAR_BLUE);
-		Gui::DrawStringCentered(0 + AddOffs, this->SetPos[1 + Idx].Y + 8, 0.45f, TEXT_WHITE, this->CharSets[this->SetListPos + Idx], 160);
+		GFX::DrawStringCentered(0 + AddOffs, this->SetPos[1 + Idx].Y + 8, 0.45f, TEXT_WHITE, this->CharSets[this->SetListPos + Idx], 160);
 		GFX::DrawCheckbox(this->SetPos[Idx + 1].X + 194 + AddOffs, this->SetPos[Idx + 1].Y + 4, (this->SetListPos + (int)Idx == this->SelectedSet), true);
 	}
 
@@ -230,24 +234,21 @@ void CharacterSetSelector::DrawSetList(const int AddOffs) {
 void CharacterSetSelector::DrawCharBottom(const int AddOffs) {
 	/* Draw Cancel and Confirm buttons. */
 	Gui::Draw_Rect(this->BottomPos[2].X + AddOffs, this->BottomPos[2].Y, this->BottomPos[2].W, this->BottomPos[2].H, BAR_BLUE);
-	Gui::DrawStringCentered(-60 + AddOffs, this->BottomPos[2].Y + 15, 0.6f, TEXT_WHITE, Lang::Get("CANCEL"), 100);
+	GFX::DrawStringCentered(-60 + AddOffs, this->BottomPos[2].Y + 15, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CANCEL), 100);
 	Gui::Draw_Rect(this->BottomPos[3].X + AddOffs, this->BottomPos[3].Y, this->BottomPos[3].W, this->BottomPos[3].H, BAR_BLUE);
-	Gui::DrawStringCentered(60 + AddOffs, this->BottomPos[3].Y + 15, 0.6f, TEXT_WHITE, Lang::Get("CONFIRM"), 100);
+	GFX::DrawStringCentered(60 + AddOffs, this->BottomPos[3].Y + 15, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CONFIRM), 100);
 
 	GFX::DrawCornerEdge(true, this->BottomPos[0].X + AddOffs, this->BottomPos[0].Y, this->BottomPos[0].H, this->CharPage >= 1);
 	GFX::DrawCornerEdge(false, this->BottomPos[1].X + AddOffs, this->BottomPos[1].Y, this->BottomPos[1].H, this->CanGoNext());
 }
 
 
+/* Draws both screens, with the fade. */
 void CharacterSetSelector::Draw() {
-	Gui::clearTextBufs();
-	C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-	C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
 	GFX::DrawTop();
 
-	if (this->IsSelecting) Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("CHARSET_SELECTOR_TITLE"), 395);
-	else Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get("CHARSET_SELECTOR_CONFIRM"), 395);
+	if (this->IsSelecting) GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CHARSET_SELECTOR_TITLE), 395);
+	else GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::CHARSET_SELECTOR_CONFIRM), 395);
 
 
 	/* Display Preview of the current set. */
@@ -265,7 +266,7 @@ void CharacterSetSelector::Draw() {
 			if (!this->CharSwipeIn && !this->CharSwipeOut) this->DrawCharacter(this->CharPage, 0); // Draw current page only.
 		}
 
-		if (this->PreviewSheet) Gui::DrawStringCentered(0, 200, 0.6f, TEXT_WHITE, Lang::Get("AMOUNT_OF_CHARACTERS") + std::to_string(C2D_SpriteSheetCount(this->PreviewSheet)), 395);
+		if (this->PreviewSheet) GFX::DrawStringCentered(0, 200, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::AMOUNT_OF_CHARACTERS) + std::to_string(C2D_SpriteSheetCount(this->PreviewSheet)), 395);
 
 		/* Previous page. */
 		Gui::DrawSprite(GFX::Sprites, sprites_small_corner_idx, 0, 25); // Draw the small top corner.
@@ -313,21 +314,27 @@ void CharacterSetSelector::Draw() {
 	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
 		if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
 	}
-
-	C3D_FrameEnd(0);
 }
 
 
 std::string CharacterSetSelector::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	this->PreviewSelection(0, false, true); // Preview 3DZwei-ROMFS Set.
 	Pointer::OnTop = true;
 	Pointer::SetPos(0, 0);
 
-	while(aptMainLoop() && !this->FullDone) {
-		this->Draw();
+	while(aptMainLoop() && !this->Done) {
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->Draw();
+			GFX::EndFrame();
+		}
+
 		this->Handler();
 	}
 
+	if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) Transition::Fade([this]() { this->Draw(); }, true);
+
 	if (this->SetGood) {
 		if (this->PreviewSheet) C2D_SpriteSheetFree(this->PreviewSheet); // We don't need the Preview anymore, so free the Spritesheet.
 	}
@@ -368,9 +375,7 @@ void CharacterSetSelector::HandleSet(const uint32_t Down, const uint32_t Held, c
 
 	if (Repeat & KEY_A) {
 		if (Pointer::Show) { // Pointer show -> Handle top.
-			for (auto &Pos : this->Positions) {
-				if (Pointer::Clicked(Pos, true)) break;
-			}
+			this->PositionsIndex.Clicked();
 
 		} else { // Since the pointer is not shown -> Straight go into preview, if good.
 			if (this->SetGood) {
@@ -380,11 +385,7 @@ void CharacterSetSelector::HandleSet(const uint32_t Down, const uint32_t Held, c
 		}
 	}
 
-	if (Repeat & KEY_TOUCH) {
-		for (auto &Pos : this->SetPos) {
-			if (Touched(Pos, T, true)) break;
-		}
-	}
+	if (Repeat & KEY_TOUCH) this->SetPosIndex.Touched(T);
 
 	/* Scroll. */
 	if (this->SelectedSet < this->SetListPos) this->SetListPos = this->SelectedSet;
@@ -403,35 +404,26 @@ void CharacterSetSelector::HandleChar(const uint32_t Down, const uint32_t Held,
 		if (this->SetGood) this->Confirm();
 	}
 
-	if (Repeat & KEY_A) {
-		for (auto &Pos : this->Positions) {
-			if (Pointer::Clicked(Pos, true)) break;
-		}
-	}
-
-	if (Repeat & KEY_TOUCH) {
-		for (auto &Pos : this->BottomPos) {
-			if (Touched(Pos, T, true)) break;
-		}
-	}
+	if (Repeat & KEY_A) this->PositionsIndex.Clicked();
+	if (Repeat & KEY_TOUCH) this->BottomPosIndex.Touched(T);
 }
 
 
 /* Main HANDLER. */
 void CharacterSetSelector::Handler() {
-	hidScanInput();
+	Input::Scan();
 	touchPosition T;
-	hidTouchRead(&T);
-	const uint32_t Down = hidKeysDown();
-	const uint32_t Held = hidKeysHeld();
-	const uint32_t Repeat = hidKeysDownRepeat();
+	Input::TouchRead(&T);
+	const uint32_t Down = Input::Down();
+	const uint32_t Held = Input::Held();
+	const uint32_t Repeat = Input::Repeat();
 
 	/* Handle FADE-INs. */
 	if (this->FadeIn) {
 		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0, this->FadeIn = false;
 
 		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
+			this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 			if (this->FAlpha <= 0) this->FadeIn = false;
 		}
@@ -445,7 +437,7 @@ void CharacterSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 320.0f) {
-			this->Cubic = std::lerp(this->Cubic, 321.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.2f);
 			this->CurSetPos = -320 + this->Cubic;
 
 			if (this->Cubic >= 320.0f) {
@@ -463,7 +455,7 @@ void CharacterSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 			this->CurPos = -400 + this->Cubic;
 
 			if (this->Cubic >= 400.0f) {
@@ -474,19 +466,6 @@ void CharacterSetSelector::Handler() {
 		return;
 	}
 
-	/* Handle FADE-OUTs. */
-	if (this->Done) {
-		if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->FullDone = true;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FullDone = true;
-		}
-
-		return;
-	}
-
 	/* Handle Mode SWIPEs. */
 	if (this->ModeSwitch) {
 		if (!_3DZwei::CFG->DoAnimation() || Repeat) {
@@ -496,7 +475,7 @@ void CharacterSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 320.0f) {
-			this->Cubic = std::lerp(this->Cubic, 321.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 321.0f, 0.2f);
 
 			if (this->Cubic >= 320.0f) this->Cubic = 0.0f, this->ModeSwitch = false;
 		}
@@ -514,7 +493,7 @@ void CharacterSetSelector::Handler() {
 		}
 
 		if (this->Cubic < 400.0f) {
-			this->Cubic = std::lerp(this->Cubic, 401.0f, 0.2f);
+			this->Cubic = Clock::Lerp(this->Cubic, 401.0f, 0.2f);
 
 			if (this->SwipeDir) this->CurPos = this->Cubic, this->PrevPos = -400 + this->Cubic; // ->.
 			else this->CurPos = 0 - this->Cubic, this->NextPos = 400 - this->Cubic; // <-.
@@ -101,80 +101,81 @@ void LanguageSelector::Cancel() { this->Done = true; } // Cancel Selection.
 
 /* Main Language Selection Logic. */
 void LanguageSelector::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	Pointer::SetPos(0, 0);
 
 	while(aptMainLoop() && !this->FullDone) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			GFX::DrawTop();
+			GFX::DrawStringCentered(0 - this->Delay, 3, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::LANG_SELECTOR_TITLE), 395);
+			Gui::DrawSprite(GFX::Sprites, sprites_logo_idx, 72 - this->Delay, 69); // Display Logo.
 
-		GFX::DrawTop();
-		Gui::DrawStringCentered(0 - this->Delay, 3, 0.6f, TEXT_WHITE, Lang::Get("LANG_SELECTOR_TITLE"), 395);
-		Gui::DrawSprite(GFX::Sprites, sprites_logo_idx, 72 - this->Delay, 69); // Display Logo.
+			if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+				if (this->Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->Delay));
+			}
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->Delay > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->Delay));
-		}
+			GFX::DrawBottom();
+			Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
 
-		GFX::DrawBottom();
-		Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, 190)); // Darker screen.
+			/* Bruh. */
+			GFX::DrawString(this->Positions[0].X - 70 - this->Delay, this->Positions[0].Y + 5, 0.5f, TEXT_WHITE, "Bruh");
+			GFX::DrawCheckbox(this->Positions[0].X - this->Delay, this->Positions[0].Y, _3DZwei::CFG->Lang() == "br");
 
-		/* Bruh. */
-		Gui::DrawString(this->Positions[0].X - 70 - this->Delay, this->Positions[0].Y + 5, 0.5f, TEXT_WHITE, "Bruh");
-		GFX::DrawCheckbox(this->Positions[0].X - this->Delay, this->Positions[0].Y, _3DZwei::CFG->Lang() == "br");
+			/* Deutsch. */
+			GFX::DrawString(this->Positions[1].X - 70 - this->Delay, this->Positions[1].Y + 5, 0.5f, TEXT_WHITE, "Deutsch");
+			GFX::DrawCheckbox(this->Positions[1].X - this->Delay, this->Positions[1].Y, _3DZwei::CFG->Lang() == "de");
 
-		/* Deutsch. */
-		Gui::DrawString(this->Positions[1].X - 70 - this->Delay, this->Positions[1].Y + 5, 0.5f, TEXT_WHITE, "Deutsch");
-		GFX::DrawCheckbox(this->Positions[1].X - this->Delay, this->Positions[1].Y, _3DZwei::CFG->Lang() == "de");
+			/* English. */
+			GFX::DrawString(this->Positions[2].X - 70 - this->Delay, this->Positions[2].Y + 5, 0.5f, TEXT_WHITE, "English");
+			GFX::DrawCheckbox(this->Positions[2].X - this->Delay, this->Positions[2].Y, _3DZwei::CFG->Lang() == "en");
 
-		/* English. */
-		Gui::DrawString(this->Positions[2].X - 70 - this->Delay, this->Positions[2].Y + 5, 0.5f, TEXT_WHITE, "English");
-		GFX::DrawCheckbox(this->Positions[2].X - this->Delay, this->Positions[2].Y, _3DZwei::CFG->Lang() == "en");
+			/* Español. */
+			GFX::DrawString(this->Positions[3].X - 70 - this->Delay, this->Positions[3].Y + 5, 0.5f, TEXT_WHITE, "Español");
+			GFX::DrawCheckbox(this->Positions[3].X - this->Delay, this->Positions[3].Y, _3DZwei::CFG->Lang() == "es");
 
-		/* Español. */
-		Gui::DrawString(this->Positions[3].X - 70 - this->Delay, this->Positions[3].Y + 5, 0.5f, TEXT_WHITE, "Español");
-		GFX::DrawCheckbox(this->Positions[3].X - this->Delay, this->Positions[3].Y, _3DZwei::CFG->Lang() == "es");
+			/* Français. */
+			GFX::DrawString(this->Positions[4].X - 70 - this->Delay, this->Positions[4].Y + 5, 0.5f, TEXT_WHITE, "Français");
+			GFX::DrawCheckbox(this->Positions[4].X - this->Delay, this->Positions[4].Y, _3DZwei::CFG->Lang() == "fr");
 
-		/* Français. */
-		Gui::DrawString(this->Positions[4].X - 70 - this->Delay, this->Positions[4].Y + 5, 0.5f, TEXT_WHITE, "Français");
-		GFX::DrawCheckbox(this->Positions[4].X - this->Delay, this->Positions[4].Y, _3DZwei::CFG->Lang() == "fr");
+			/* Italiano. */
+			GFX::DrawString(this->Positions[5].X - 70 + this->Delay, this->Positions[5].Y + 5, 0.5f, TEXT_WHITE, "Italiano");
+			GFX::DrawCheckbox(this->Positions[5].X + this->Delay, this->Positions[5].Y, _3DZwei::CFG->Lang() == "it");
 
-		/* Italiano. */
-		Gui::DrawString(this->Positions[5].X - 70 + this->Delay, this->Positions[5].Y + 5, 0.5f, TEXT_WHITE, "Italiano");
-		GFX::DrawCheckbox(this->Positions[5].X + this->Delay, this->Positions[5].Y, _3DZwei::CFG->Lang() == "it");
+			/* 日本語. */
+			GFX::DrawString(this->Positions[6].X - 70 + this->Delay, this->Positions[6].Y + 5, 0.5f, TEXT_WHITE, "日本語");
+			GFX::DrawCheckbox(this->Positions[6].X + this->Delay, this->Positions[6].Y, _3DZwei::CFG->Lang() == "ja");
 
-		/* 日本語. */
-		Gui::DrawString(this->Positions[6].X - 70 + this->Delay, this->Positions[6].Y + 5, 0.5f, TEXT_WHITE, "日本語");
-		GFX::DrawCheckbox(this->Positions[6].X + this->Delay, this->Positions[6].Y, _3DZwei::CFG->Lang() == "ja");
+			/* Polski. */
+			GFX::DrawString(this->Positions[7].X - 70 + this->Delay, this->Positions[7].Y + 5, 0.5f, TEXT_WHITE, "Polski");
+			GFX::DrawCheckbox(this->Positions[7].X + this->Delay, this->Positions[7].Y, _3DZwei::CFG->Lang() == "pl");
 
-		/* Polski. */
-		Gui::DrawString(this->Positions[7].X - 70 + this->Delay, this->Positions[7].Y + 5, 0.5f, TEXT_WHITE, "Polski");
-		GFX::DrawCheckbox(this->Positions[7].X + this->Delay, this->Positions[7].Y, _3DZwei::CFG->Lang() == "pl");
+			/* Português. */
+			GFX::DrawString(this->Positions[8].X - 70 + this->Delay, this->Positions[8].Y + 5, 0.5f, TEXT_WHITE, "Português");
+			GFX::DrawCheckbox(this->Positions[8].X + this->Delay, this->Positions[8].Y, _3DZwei::CFG->Lang() == "pt");
 
-		/* Português. */
-		Gui::DrawString(this->Positions[8].X - 70 + this->Delay, this->Positions[8].Y + 5, 0.5f, TEXT_WHITE, "Português");
-		GFX::DrawCheckbox(this->Positions[8].X + this->Delay, this->Positions[8].Y, _3DZwei::CFG->Lang() == "pt");
+			/* Русский. */
+			GFX::DrawString(this->Positions[9].X - 70 + this->Delay, this->Positions[9].Y + 5, 0.5f, TEXT_WHITE, "Русский");
+			GFX::DrawCheckbox(this->Positions[9].X + this->Delay, this->Positions[9].Y, _3DZwei::CFG->Lang() == "ru");
 
-		/* Русский. */
-		Gui::DrawString(this->Positions[9].X - 70 + this->Delay, this->Positions[9].Y + 5, 0.5f, TEXT_WHITE, "Русский");
-		GFX::DrawCheckbox(this->Positions[9].X + this->Delay, this->Positions[9].Y, _3DZwei::CFG->Lang() == "ru");
+			Gui::Draw_Rect(this->Positions[10].X, this->Positions[10].Y, this->Positions[10].W, this->Positions[10].H, BAR_BLUE); // Back.
+			Gui::DrawSprite(GFX::Sprites, sprites_back_btn_idx, this->Positions[10].X, this->Positions[10].Y);
 
-		Gui::Draw_Rect(this->Positions[10].X, this->Positions[10].Y, this->Positions[10].W, this->Positions[10].H, BAR_BLUE); // Back.
-		Gui::DrawSprite(GFX::Sprites, sprites_back_btn_idx, this->Positions[10].X, this->Positions[10].Y);
+			Pointer::Draw();
+			if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+				if (this->Delay > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->Delay));
+			}
 
-		Pointer::Draw();
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->Delay > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->Delay));
+			GFX::EndFrame();
 		}
 
-		C3D_FrameEnd(0);
+		Lang::Prewarm(); // Caches the strings of a newly selected language.
 
 		if (this->Start) {
 			if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->Delay = 0, this->Start = false;
 			else {
 				if (this->Cubic < 255.0f) {
-					this->Cubic = std::lerp(this->Cubic, 256.0f, 0.1f);
+					this->Cubic = Clock::Lerp(this->Cubic, 256.0f, 0.1f);
 					this->Delay = 255 - this->Cubic;
 
 					if (this->Cubic >= 255.0f) {
@@ -185,13 +186,13 @@ void LanguageSelector::Action() {
 
 		} else {
 			if (this->Done) {
-				hidScanInput();
-				const uint32_t Down = hidKeysDown();
+				Input::Scan();
+				const uint32_t Down = Input::Down();
 
 				if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade() || Down) this->Delay = 255, this->FullDone = true;
 				else {
 					if (this->Cubic < 255.0f) {
-						this->Cubic = std::lerp(this->Cubic, 256.0f, 0.1f);
+						this->Cubic = Clock::Lerp(this->Cubic, 256.0f, 0.1f);
 						this->Delay = this->Cubic;
 
 						if (this->Cubic >= 255.0f) {
@@ -201,26 +202,17 @@ void LanguageSelector::Action() {
 				}
 
 			} else {
-				hidScanInput();
+				Input::Scan();
 				touchPosition T;
-				hidTouchRead(&T);
-				const uint32_t Down = hidKeysDown();
-				const uint32_t Held = hidKeysHeld();
+				Input::TouchRead(&T);
+				const uint32_t Down = Input::Down();
+				const uint32_t Held = Input::Held();
 				Pointer::ScrollHandling(Held);
 
 				if (Down & KEY_START || Down & KEY_B) this->Done = true; // START or B can exit as well.
 
-				if (Down & KEY_A) {
-					for (auto &Position : this->Positions) {
-						if (Pointer::Clicked(Position, true)) break;
-					}
-				}
-
-				if (Down & KEY_TOUCH) {
-					for (auto &Position : this->Positions) {
-						if (Touched(Position, T, true)) break;
-					}
-				}
+				if (Down & KEY_A) this->PositionsIndex.Clicked();
+				if (Down & KEY_TOUCH) this->PositionsIndex.Touched(T);
 			}
 		}
 	}
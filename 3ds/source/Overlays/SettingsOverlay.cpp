@@ -32,46 +32,38 @@
 #include "Numpad.hpp"
 #include "SettingsOverlay.hpp"
 #include "SplashOverlay.hpp"
+#include "Transition.hpp" // Fades.
 #include "Utils.hpp"
 
 
 void SettingsOverlay::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) this->FAlpha = 0;
 
 	while(aptMainLoop() && !this->Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		this->DrawTabs();
-		C3D_FrameEnd(0);
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			this->DrawTop();
+			this->DrawTabs();
+			GFX::EndFrame();
+		}
 
 		/* Tab Animation handler. */
 		if (this->DoSwipe || this->InitialSwipe) {
 			this->TabHandler();
 
 		} else {
-			hidScanInput();
+			Input::Scan();
 			touchPosition T;
-			const uint32_t Down = hidKeysDown();
-			const uint32_t Held = hidKeysHeld();
-			hidTouchRead(&T);
+			const uint32_t Down = Input::Down();
+			const uint32_t Held = Input::Held();
+			Input::TouchRead(&T);
 			Pointer::ScrollHandling(Held); // Pointer Handling.
 
 			if (Down & KEY_B) this->Back();
 			if (Down & KEY_SELECT) _3DZwei::CFG->PointerSpeed(4); // Reset.
-			if (Down & KEY_A) {
-				for (auto &Position : (this->Tab == SettingsTab::Configuration ? this->Positions : this->AnimPos)) {
-					if (Pointer::Clicked(Position, true)) break;
-				}
-			}
-
-			if (Down & KEY_TOUCH) {
-				for (auto &Position : (this->Tab == SettingsTab::Configuration ? this->Positions : this->AnimPos)) {
-					if (Touched(Position, T, true)) break;
-				}
-			}
+			if (Down & KEY_A) (this->Tab == SettingsTab::Configuration ? this->PositionsIndex : this->AnimPosIndex).Clicked();
+			if (Down & KEY_TOUCH) (this->Tab == SettingsTab::Configuration ? this->PositionsIndex : this->AnimPosIndex).Touched(T);
 		}
 	}
 }
@@ -182,7 +174,7 @@ void SettingsOverlay::ShowSplash() {
 /* Set the Pointer movement speed. */
 void SettingsOverlay::SetPointerSpeed() {
 	if (this->Tab == SettingsTab::Configuration) {
-		std::unique_ptr<Numpad> Ovl = std::make_unique<Numpad>(3, _3DZwei::CFG->PointerSpeed(), 255, Lang::Get("SETTINGS_POINTER_SPEED_TXT"));
+		std::unique_ptr<Numpad> Ovl = std::make_unique<Numpad>(3, _3DZwei::CFG->PointerSpeed(), 255, Lang::Get(Lang::Str::SETTINGS_POINTER_SPEED_TXT));
 		_3DZwei::CFG->PointerSpeed(Ovl->Action());
 	}
 }
@@ -233,8 +225,8 @@ void SettingsOverlay::Back() {
 /* Draw the Top. */
 void SettingsOverlay::DrawTop() const {
 	GFX::DrawTop();
-	Gui::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, "3DZwei", 395);
-	Gui::DrawString(340, 3, 0.6f, TEXT_WHITE, V_STRING);
+	GFX::DrawStringCentered(0, 3, 0.6f, TEXT_WHITE, "3DZwei", 395);
+	GFX::DrawString(340, 3, 0.6f, TEXT_WHITE, V_STRING);
 	Gui::DrawSprite(GFX::Sprites, sprites_stackz_idx, 10, 62);
 	Gui::DrawSprite(GFX::Sprites, sprites_logo_idx, 130, 58);
 
@@ -271,84 +263,84 @@ void SettingsOverlay::DrawTabs() const {
 	if (this->Tab != SettingsTab::AppInfo) Gui::Draw_Rect(213, 0, 106, 20, BAR_BLUE);
 
 	/* I'm too lazy to center right now, so TODO. */
-	Gui::DrawStringCentered(-106, 3, 0.45f, TEXT_WHITE, Lang::Get("SETTINGS_TAB_CONFIG"), 100);
-	Gui::DrawStringCentered(0, 3, 0.45f, TEXT_WHITE, Lang::Get("SETTINGS_TAB_ANIMATION"), 100);
-	Gui::DrawStringCentered(106, 3, 0.45f, TEXT_WHITE, Lang::Get("SETTINGS_TAB_APPINFO"), 100);
+	GFX::DrawStringCentered(-106, 3, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_TAB_CONFIG), 100);
+	GFX::DrawStringCentered(0, 3, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_TAB_ANIMATION), 100);
+	GFX::DrawStringCentered(106, 3, 0.45f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_TAB_APPINFO), 100);
 
 	/* Only draw between -320 and 320. */
 	if (this->CurTabOffs[0] >= -320 && this->CurTabOffs[0] <= 320) { // Configuration.
 		/* Language. */
-		Gui::DrawString(15 + this->CurTabOffs[0], this->Positions[3].Y + 5 - (Lang::Get("SETTINGS_LANGUAGE").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_LANGUAGE"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[0], this->Positions[3].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_LANGUAGE).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_LANGUAGE), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->Positions[3].X + this->CurTabOffs[0], this->Positions[3].Y);
-		Gui::DrawString(200 + this->CurTabOffs[0], this->Positions[3].Y + 5, 0.4f, TEXT_WHITE, this->GetLanguage());
+		GFX::DrawString(200 + this->CurTabOffs[0], this->Positions[3].Y + 5, 0.4f, TEXT_WHITE, this->GetLanguage());
 
 		/* Active Cardset. */
-		Gui::DrawString(15 + this->CurTabOffs[0], this->Positions[4].Y + 5 - (Lang::Get("SETTINGS_ACTIVE_CARDSET").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_ACTIVE_CARDSET"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[0], this->Positions[4].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_ACTIVE_CARDSET).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_ACTIVE_CARDSET), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->Positions[4].X + this->CurTabOffs[0], this->Positions[4].Y);
-		Gui::DrawString(200 + this->CurTabOffs[0], this->Positions[4].Y + 5 - (_3DZwei::CFG->CardSet().length() / 23 * 10 / 2), 0.4f, TEXT_WHITE, _3DZwei::CFG->CardSet(), 110, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(200 + this->CurTabOffs[0], this->Positions[4].Y + 5 - (_3DZwei::CFG->CardSet().length() / 23 * 10 / 2), 0.4f, TEXT_WHITE, _3DZwei::CFG->CardSet(), 110, 15, nullptr, C2D_WordWrap);
 
 		/* Active Charset. */
-		Gui::DrawString(15 + this->CurTabOffs[0], this->Positions[5].Y + 5 - (Lang::Get("SETTINGS_ACTIVE_CHARSET").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_ACTIVE_CHARSET"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[0], this->Positions[5].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_ACTIVE_CHARSET).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_ACTIVE_CHARSET), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->Positions[5].X + this->CurTabOffs[0], this->Positions[5].Y);
-		Gui::DrawString(200 + this->CurTabOffs[0], this->Positions[5].Y + 5 - (_3DZwei::CFG->CharSet().length() / 23 * 10 / 2), 0.4f, TEXT_WHITE, _3DZwei::CFG->CharSet(), 110, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(200 + this->CurTabOffs[0], this->Positions[5].Y + 5 - (_3DZwei::CFG->CharSet().length() / 23 * 10 / 2), 0.4f, TEXT_WHITE, _3DZwei::CFG->CharSet(), 110, 15, nullptr, C2D_WordWrap);
 
 		/* If showing splash on startup, or nah. */
-		Gui::DrawString(15 + this->CurTabOffs[0], this->Positions[6].Y + 5 - (Lang::Get("SETTINGS_SHOW_SPLASH").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_SHOW_SPLASH"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[0], this->Positions[6].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_SHOW_SPLASH).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_SHOW_SPLASH), 125, 15, nullptr, C2D_WordWrap);
 		GFX::DrawCheckbox(this->Positions[6].X + this->CurTabOffs[0], this->Positions[6].Y, _3DZwei::CFG->ShowSplash());
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->Positions[7].X + this->CurTabOffs[0], this->Positions[7].Y);
 
 		/* Pointer Speed. */
-		Gui::DrawString(15 + this->CurTabOffs[0], this->Positions[8].Y + 5 - (Lang::Get("SETTINGS_POINTER_SPEED").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_POINTER_SPEED"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[0], this->Positions[8].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_POINTER_SPEED).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_POINTER_SPEED), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->Positions[8].X + this->CurTabOffs[0], this->Positions[8].Y);
-		Gui::DrawString(200 + this->CurTabOffs[0], this->Positions[8].Y + 5, 0.4f, TEXT_WHITE, std::to_string(_3DZwei::CFG->PointerSpeed()), 110);
+		GFX::DrawString(200 + this->CurTabOffs[0], this->Positions[8].Y + 5, 0.4f, TEXT_WHITE, std::to_string(_3DZwei::CFG->PointerSpeed()), 110);
 
-		Gui::DrawString(15 + this->CurTabOffs[0], this->Positions[9].Y + 5 - (Lang::Get("SETTINGS_GAME_DEFAULTS").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_GAME_DEFAULTS"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[0], this->Positions[9].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_GAME_DEFAULTS).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_GAME_DEFAULTS), 125, 15, nullptr, C2D_WordWrap);
 		Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->Positions[9].X + this->CurTabOffs[0], this->Positions[9].Y);
 	}
 
 	/* Only draw between -320 and 320. */
 	if (this->CurTabOffs[1] >= -320 && this->CurTabOffs[1] <= 320) { // Animations.
 		/* If doing Animation or nah. */
-		Gui::DrawString(15 + this->CurTabOffs[1], this->AnimPos[3].Y + 5 - (Lang::Get("SETTINGS_ANIMATION").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_ANIMATION"), 125, 15, nullptr, C2D_WordWrap);
+		GFX::DrawString(15 + this->CurTabOffs[1], this->AnimPos[3].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_ANIMATION).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_ANIMATION), 125, 15, nullptr, C2D_WordWrap);
 		GFX::DrawCheckbox(this->AnimPos[3].X + this->CurTabOffs[1], this->AnimPos[3].Y, _3DZwei::CFG->DoAnimation());
 
 		if (_3DZwei::CFG->DoAnimation()) { // Only show those options, if Animations are globally enabled.
 			/* The Game Animation, which to use. */
-			Gui::DrawString(15 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get("SETTINGS_GAME_ANIMATION").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_GAME_ANIMATION"), 125, 15, nullptr, C2D_WordWrap);
+			GFX::DrawString(15 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION), 125, 15, nullptr, C2D_WordWrap);
 			Gui::DrawSprite(GFX::Sprites, sprites_stripe_idx, this->AnimPos[4].X + this->CurTabOffs[1], this->AnimPos[4].Y);
 
 			switch(_3DZwei::CFG->GameAnimation()) {
 				case 0: // Random.
-					Gui::DrawString(200 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get("SETTINGS_GAME_ANIMATION_RANDOM").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_GAME_ANIMATION_RANDOM"), 110);
+					GFX::DrawString(200 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION_RANDOM).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION_RANDOM), 110);
 					break;
 
 				case 1: // Falling cards.
-					Gui::DrawString(200 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get("SETTINGS_GAME_ANIMATION_FALL").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_GAME_ANIMATION_FALL"), 110);
+					GFX::DrawString(200 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION_FALL).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION_FALL), 110);
 					break;
 
 				case 2: // Growing Cards.
-					Gui::DrawString(200 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get("SETTINGS_GAME_ANIMATION_GROW").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_GAME_ANIMATION_GROW"), 110);
+					GFX::DrawString(200 + this->CurTabOffs[1], this->AnimPos[4].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION_GROW).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_GAME_ANIMATION_GROW), 110);
 					break;
 			}
 
 			/* Visual Page Switch. */
-			Gui::DrawString(15 + this->CurTabOffs[1], this->AnimPos[5].Y + 5 - (Lang::Get("SETTINGS_PAGE_SWITCH").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_PAGE_SWITCH"), 125, 15, nullptr, C2D_WordWrap);
+			GFX::DrawString(15 + this->CurTabOffs[1], this->AnimPos[5].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_PAGE_SWITCH).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_PAGE_SWITCH), 125, 15, nullptr, C2D_WordWrap);
 			GFX::DrawCheckbox(this->AnimPos[5].X + this->CurTabOffs[1], this->AnimPos[5].Y, _3DZwei::CFG->PageSwitch());
 
 			/* Do Fade. */
-			Gui::DrawString(15 + this->CurTabOffs[1], this->AnimPos[6].Y + 5 - (Lang::Get("SETTINGS_FADE").length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get("SETTINGS_FADE"), 125, 15, nullptr, C2D_WordWrap);
+			GFX::DrawString(15 + this->CurTabOffs[1], this->AnimPos[6].Y + 5 - (Lang::Get(Lang::Str::SETTINGS_FADE).length() / 25 * 10 / 2), 0.4f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_FADE), 125, 15, nullptr, C2D_WordWrap);
 			GFX::DrawCheckbox(this->AnimPos[6].X + this->CurTabOffs[1], this->AnimPos[6].Y, _3DZwei::CFG->DoFade());
 		}
 	}
 
 	/* Only draw between -320 and 320. */
 	if (this->CurTabOffs[2] >= -320 && this->CurTabOffs[2] <= 320) { // App Info.
-		Gui::DrawString(10 + this->CurTabOffs[2], 50, 0.5f, TEXT_WHITE, Lang::Get("SETTINGS_BUILD_VERSION") + std::string(V_STRING));
-		Gui::DrawString(10 + this->CurTabOffs[2], 80, 0.5f, TEXT_WHITE, Lang::Get("SETTINGS_BUILD_HASH") + std::string(V_SHA));
-		Gui::DrawStringCentered(0 + this->CurTabOffs[2], 110, 0.6f, TEXT_WHITE, Lang::Get("SETTINGS_LATEST_CHANGES"));
+		GFX::DrawString(10 + this->CurTabOffs[2], 50, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_BUILD_VERSION) + std::string(V_STRING));
+		GFX::DrawString(10 + this->CurTabOffs[2], 80, 0.5f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_BUILD_HASH) + std::string(V_SHA));
+		GFX::DrawStringCentered(0 + this->CurTabOffs[2], 110, 0.6f, TEXT_WHITE, Lang::Get(Lang::Str::SETTINGS_LATEST_CHANGES));
 
 		/* Change this, after changes. */
-		Gui::DrawStringCentered(0 + this->CurTabOffs[2], 130, 0.4f, TEXT_WHITE,
+		GFX::DrawStringCentered(0 + this->CurTabOffs[2], 130, 0.4f, TEXT_WHITE,
 			"[UI]: Reworking the UI colors a bit.",
 		310);
 	}
@@ -368,52 +360,17 @@ void SettingsOverlay::DrawTabs() const {
 void SettingsOverlay::FadeOutHandler() {
 	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) return;
 
-	this->FadeOut = true;
 	this->FAlpha = 0;
-
-	while(aptMainLoop() && this->FadeOut) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		this->DrawTabs();
-		C3D_FrameEnd(0);
-
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
-		if (Down) this->FAlpha = 255, this->FadeOut = false;
-
-		if (this->FAlpha < 255) {
-			this->FAlpha += 5;
-
-			if (this->FAlpha >= 255) this->FadeOut = false;
-		}
-	}
+	Transition::Fade([this]() { this->DrawTop(); this->DrawTabs(); }, true);
+	this->FAlpha = 255;
 }
 
 
 void SettingsOverlay::FadeInHandler() {
 	if (!_3DZwei::CFG->DoAnimation() || !_3DZwei::CFG->DoFade()) return;
 
-	this->FadeIn = true;
-	this->FAlpha = 255;
-
-	while(aptMainLoop() && this->FadeIn) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		this->DrawTop();
-		this->DrawTabs();
-		C3D_FrameEnd(0);
-
-		if (this->FAlpha > 0) {
-			this->FAlpha -= 5;
-
-			if (this->FAlpha <= 0) this->FadeIn = false;
-		}
-	}
+	this->FAlpha = 0; // The snapshot is taken without the black rectangle.
+	Transition::Fade([this]() { this->DrawTop(); this->DrawTabs(); }, false);
 }
 
 
@@ -428,7 +385,7 @@ void SettingsOverlay::TabHandler() {
 		} else {
 			if (_3DZwei::CFG->DoFade()) {
 				if (this->FadeIn) {
-					this->FAlpha -= 5;
+					this->FAlpha = std::max(0, this->FAlpha - Clock::Step(5));
 
 					if (this->FAlpha <= 0) this->FadeIn = false;
 				}
@@ -441,7 +398,7 @@ void SettingsOverlay::TabHandler() {
 			}
 
 			if (this->Swipe < 320.0f) {
-				this->Swipe = std::lerp(this->Swipe, 320.0f, 0.1f);
+				this->Swipe = Clock::Lerp(this->Swipe, 320.0f, 0.1f);
 
 				this->CurTabOffs[0] = this->PrevTabOffs[0] + this->Swipe;
 
@@ -458,8 +415,8 @@ void SettingsOverlay::TabHandler() {
 		}
 	}
 
-	hidScanInput();
-	const uint32_t Down = hidKeysDown();
+	Input::Scan();
+	const uint32_t Down = Input::Down();
 
 	if (this->Swipe < this->ToSwipe) {
 		if (!_3DZwei::CFG->DoAnimation() || Down) { // No animation.
@@ -484,7 +441,7 @@ void SettingsOverlay::TabHandler() {
 			this->ToSwipe = 0.0f, this->Swipe = 0.0f; // Reset.
 
 		} else {
-			this->Swipe = std::lerp(this->Swipe, this->ToSwipe, 0.1f);
+			this->Swipe = Clock::Lerp(this->Swipe, this->ToSwipe, 0.1f);
 
 			if (this->SwipeDir) { // We are going forward, soo --;
 				this->CurTabOffs[0] = this->PrevTabOffs[0] - this->Swipe; // Tab 1.
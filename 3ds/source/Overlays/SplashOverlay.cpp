@@ -30,14 +30,17 @@
 
 /* STATE 1: Handle Going to first card. */
 void SplashOverlay::State1() {
+	const float Step = 2.0f * Clock::Frames(); // 2 pixels per 60 FPS frame.
+	GFX::Invalidate(); // The pointer moves.
+
 	if (this->X > this->Cards[0].X + 20) {
-		this->X -= 2;
+		this->X = std::max(this->Cards[0].X + 20, this->X - Step);
 
 		if (this->X != this->Cards[0].X + 20) return;
 	}
 
 	if (this->Y > this->Cards[0].Y + 20) {
-		this->Y -= 2;
+		this->Y = std::max(this->Cards[0].Y + 20, this->Y - Step);
 
 		if (this->Y != this->Cards[0].Y + 20) return;
 	}
@@ -48,13 +51,16 @@ void SplashOverlay::State1() {
 
 /* STATE 2: Handle flip on the first card + Swipe the StackMem Logo. */
 void SplashOverlay::State2() {
-	if (this->CoreMoved < 160) this->CoreMoved += 2;
+	if (this->CoreMoved < 160) { // 2 pixels per 60 FPS frame.
+		this->CoreMoved = std::min(160.0f, this->CoreMoved + 2.0f * Clock::Frames());
+		GFX::Invalidate();
+	}
 
 	/* Card Flip. */
-	if (this->CoreMoved == 160 && !this->FlipDone[0]) {
+	if (this->CoreMoved == 160.0f && !this->FlipDone[0]) {
 		if (!this->CardFlipped[0]) { // Scale down the back cover -- first operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 
 				this->CardScale[0] = 1.0f - Cubic;
 
@@ -67,7 +73,7 @@ void SplashOverlay::State2() {
 
 		} else { // Scale up the front cover -- second operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 				this->CardScale[0] = this->Cubic;
 
 				if (this->Cubic >= 1.0f) {
@@ -79,20 +85,23 @@ void SplashOverlay::State2() {
 		}
 	}
 
-	if (this->FlipDone[0] && this->CoreMoved == 160) this->State = States::GotoSecond;
+	if (this->FlipDone[0] && this->CoreMoved == 160.0f) this->State = States::GotoSecond;
 }
 
 
 /* STATE 3: Handle Going to second card. */
 void SplashOverlay::State3() {
+	const float Step = 2.0f * Clock::Frames(); // 2 pixels per 60 FPS frame.
+	GFX::Invalidate(); // The pointer moves.
+
 	if (this->X < this->Cards[8].X + 20) {
-		this->X += 2;
+		this->X = std::min(this->Cards[8].X + 20, this->X + Step);
 
 		if (this->X != this->Cards[8].X + 20) return;
 	}
 
 	if (this->Y < this->Cards[8].Y + 20) {
-		this->Y += 2;
+		this->Y = std::min(this->Cards[8].Y + 20, this->Y + Step);
 
 		if (this->Y != this->Cards[8].Y + 20) return;
 	}
@@ -103,13 +112,16 @@ void SplashOverlay::State3() {
 
 /* STATE 4: Swipe the StackMem Logo further, flip the second card and go into the fade-out State. */
 void SplashOverlay::State4() {
-	if (this->CoreMoved < 320) this->CoreMoved += 2;
+	if (this->CoreMoved < 320) { // 2 pixels per 60 FPS frame.
+		this->CoreMoved = std::min(320.0f, this->CoreMoved + 2.0f * Clock::Frames());
+		GFX::Invalidate();
+	}
 
 	/* Card Flip. */
-	if (this->CoreMoved == 320 && !this->FlipDone[1]) {
+	if (this->CoreMoved == 320.0f && !this->FlipDone[1]) {
 		if (!this->CardFlipped[1]) { // Scale down the back cover -- first operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 
 				this->CardScale[1] = 1.0f - Cubic;
 
@@ -122,7 +134,7 @@ void SplashOverlay::State4() {
 
 		} else { // Scale up the front cover -- second operation.
 			if (this->Cubic < 1.0f) {
-				this->Cubic = std::lerp(this->Cubic, 2.0f, 0.1f);
+				this->Cubic = Clock::Lerp(this->Cubic, 2.0f, 0.1f);
 				this->CardScale[1] = this->Cubic;
 
 				if (this->Cubic >= 1.0f) {
@@ -134,20 +146,28 @@ void SplashOverlay::State4() {
 		}
 	}
 
-	if (this->FlipDone[1] && this->CoreMoved == 320) this->State = States::FadeOut;
+	if (this->FlipDone[1] && this->CoreMoved == 320.0f) this->State = States::FadeOut;
 }
 
 
 /* STATE 5: Fade out. */
 void SplashOverlay::State5() {
-	if (this->FAlpha < 255) this->FAlpha += 2;
-	if (this->FAlpha == 255) this->Done = true;
+	if (this->FAlpha == 255.0f) { // Only done after the black frame got drawn.
+		this->Done = true;
+		return;
+	}
+
+	this->FAlpha = std::min(255.0f, this->FAlpha + 2.0f * Clock::Frames());
+	GFX::Invalidate();
 }
 
 
 void SplashOverlay::StateHandler() {
 	if (this->State != States::FadeOut) {
-		if (this->FAlpha > 0) this->FAlpha -= 2; // Handle Alpha Fading.
+		if (this->FAlpha > 0.0f) { // Handle Alpha Fading.
+			this->FAlpha = std::max(0.0f, this->FAlpha - 2.0f * Clock::Frames());
+			GFX::Invalidate();
+		}
 	}
 
 	switch(this->State) {
@@ -175,47 +195,50 @@ void SplashOverlay::StateHandler() {
 
 
 void SplashOverlay::Action() {
+	GFX::Invalidate(); // A new screen is shown.
+
 	while(aptMainLoop() && !this->Done) {
-		Gui::clearTextBufs();
-		C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
-		C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
-		C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
-		GFX::DrawTop();
-
-		/* First real card. */
-		if (this->CardFlipped[0]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
-		else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
-
-		/* Hidden cards. */
-		for (uint8_t Idx = 1; Idx < 8; Idx++) {
-			Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[Idx].X, this->Cards[Idx].Y);
-		}
+		if (GFX::BeginFrame()) { // Only draw, if something changed.
+			GFX::DrawTop();
 
-		/* Second real card. */
-		if (this->CardFlipped[1]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[8].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[8].Y, this->CardScale[1], 1.0f);
-		else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[8].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[8].Y, this->CardScale[1], 1.0f);
+			/* First real card. */
+			if (this->CardFlipped[0]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
+			else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[0].X + (1.0f - this->CardScale[0]) * 55 / 2, this->Cards[0].Y, this->CardScale[0], 1.0f);
 
-		Gui::DrawSprite(GFX::Sprites, sprites_pointer_idx, this->X, this->Y);
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, this->FAlpha));
-		}
+			/* Hidden cards. */
+			for (uint8_t Idx = 1; Idx < 8; Idx++) {
+				Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[Idx].X, this->Cards[Idx].Y);
+			}
 
-		GFX::DrawBottom();
-		if (this->State != States::FadeOut) Gui::DrawSprite(GFX::Sprites, sprites_stackmemcore_idx, 32 - this->CoreMoved, 52);
-		Gui::DrawSprite(GFX::Sprites, sprites_universal_core_idx, 320 - this->CoreMoved, 56);
+			/* Second real card. */
+			if (this->CardFlipped[1]) Gui::DrawSprite(GFX::Sprites, sprites_voltcard_idx, this->Cards[8].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[8].Y, this->CardScale[1], 1.0f);
+			else Gui::DrawSprite(GFX::Sprites, sprites_icon_idx, this->Cards[8].X + (1.0f - this->CardScale[1]) * 55 / 2, this->Cards[8].Y, this->CardScale[1], 1.0f);
 
-		if (this->State == States::FadeOut) { // The last State -> Copyright + StackZ Image.
-			Gui::DrawStringCentered(0, 190, 0.55f, TEXT_WHITE, "3DZwei\nCopyright (C) Universal-Team 2020 - 2021");
-			Gui::DrawSprite(GFX::Sprites, sprites_stackz_idx, 213, 50);
-		}
+			Gui::DrawSprite(GFX::Sprites, sprites_pointer_idx, this->X, this->Y);
+			if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+				if (this->FAlpha > 0.0f) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, (uint8_t)this->FAlpha));
+			}
 
-		if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
-			if (this->FAlpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, this->FAlpha));
+			GFX::DrawBottom();
+			if (this->State != States::FadeOut) Gui::DrawSprite(GFX::Sprites, sprites_stackmemcore_idx, 32 - this->CoreMoved, 52);
+			Gui::DrawSprite(GFX::Sprites, sprites_universal_core_idx, 320 - this->CoreMoved, 56);
+
+			if (this->State == States::FadeOut) { // The last State -> Copyright + StackZ Image.
+				GFX::DrawStringCentered(0, 190, 0.55f, TEXT_WHITE, "3DZwei\nCopyright (C) Universal-Team 2020 - 2021");
+				Gui::DrawSprite(GFX::Sprites, sprites_stackz_idx, 213, 50);
+			}
+
+			if (_3DZwei::CFG->DoAnimation() && _3DZwei::CFG->DoFade()) {
+				if (this->FAlpha > 0.0f) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, (uint8_t)this->FAlpha));
+			}
+
+			GFX::EndFrame();
 		}
 
-		C3D_FrameEnd(0);
-		hidScanInput();
-		const uint32_t Down = hidKeysDown();
+		Lang::Prewarm(); // Caches the strings of the menus meanwhile.
+
+		Input::Scan();
+		const uint32_t Down = Input::Down();
 		if (Down) this->Done = true; // Any key -> Skip.
 		this->StateHandler();
 	}
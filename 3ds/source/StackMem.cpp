@@ -133,19 +133,26 @@
 		const bool Result = Game->DoCheck();
 		-- This function returns true, if the played cards matched, or false if it did not.
 
-		--- If it matches, just call:
-			Game->SetState(StackMem::TurnState::DrawFirst);
-			This will set the State so you can play again.
+		--- The turn is over then and the State is StackMem::TurnState::DrawFirst again, so you can play again.
 
 		---- If it didn't match, just call:
 			Game->NextPlayer();
-			This will set the proper continue State + switches to the next Player.
+			This switches to the next Player.
+
+		----- With Game->DoCheck(false), the cards stay as they are for animations. Collect (SetCardCollected) them after a match
+		      and call Game->ResetTurn(Result) afterwards, which hides them after a miss and ends the turn.
 
 
 	Something nicely to have as well:
 		const int ProperPair = Game->GetProperPair();
 		-- This function returns the proper Index from the first played card.
 		   ( Assuming the Current State is StackMem::TurnState::DrawSecond ).
+
+
+	The setters (SetCardShown, SetCardCollected, SetState) refuse changes, that would leave the game inconsistent.
+	Check the game yourself with:
+		const bool Good = Game->CheckIntegrity();
+		-- This function returns false, if the Gamefield, the Pairs or the play cards don't match up anymore.
 */
 
 
@@ -336,6 +343,7 @@ void StackMem::InitializeGame(const size_t Pairs, const bool AIUsed, const Stack
 	this->GenerateField(Pairs);
 	this->PlayerPairs[0] = 0, this->PlayerPairs[1] = 0; // Set Player Pairs to 0.
 	this->PlayCards[0] = -1, this->PlayCards[1] = -1; // Set both turn play cards to -1.
+	this->Checked = false;
 	this->CurrentPlayer = StackMem::Players::Player1; // Set to Player 1.
 	this->State = StackMem::TurnState::DrawFirst; // The current State is drawing the first card.
 }
@@ -348,7 +356,11 @@ bool StackMem::IsCardCollected(const size_t Idx) const {
 	return true;
 }
 void StackMem::SetCardCollected(const size_t Idx, const bool Collected) {
-	if (Idx < (this->GetPairs() * 2)) this->Gamefield[Idx].Collected = Collected;
+	if (Idx >= (this->GetPairs() * 2)) return;
+
+	const bool Old = this->Gamefield[Idx].Collected;
+	this->Gamefield[Idx].Collected = Collected;
+	if (!this->CheckIntegrity()) this->Gamefield[Idx].Collected = Old; // Keep the old state, it would be inconsistent.
 }
 
 
@@ -359,7 +371,23 @@ bool StackMem::IsCardShown(const size_t Idx) const {
 	return false;
 }
 void StackMem::SetCardShown(const size_t Idx, const bool Shown) {
-	if (Idx < (this->GetPairs() * 2)) this->Gamefield[Idx].Shown = Shown;
+	if (Idx >= (this->GetPairs() * 2)) return;
+
+	const bool Old = this->Gamefield[Idx].Shown;
+	this->Gamefield[Idx].Shown = Shown;
+	if (!this->CheckIntegrity()) this->Gamefield[Idx].Shown = Old; // Keep the old state, it would be inconsistent.
+}
+
+
+/*
+	Sets the Turn State, if the play cards match it.
+
+	const StackMem::TurnState State: The new State.
+*/
+void StackMem::SetState(const StackMem::TurnState State) {
+	const StackMem::TurnState Old = this->State;
+	this->State = State;
+	if (!this->CheckIntegrity()) this->State = Old; // Keep the old state, it would be inconsistent.
 }
 
 
@@ -388,6 +416,9 @@ bool StackMem::CheckMatch() const {
 */
 bool StackMem::DoCheck(const bool HideCards) {
 	if (this->PlayCards[0] != -1 && this->PlayCards[1] != -1 && this->GetState() == StackMem::TurnState::DoCheck) { // Ensure they are not -1.
+		if (this->Checked) return this->CheckMatch(); // Already handled, only return the result again.
+		this->Checked = true;
+
 		if (this->CheckMatch()) { // Check if both current Cards match.
 			/* Card matches, so set a pair. */
 			switch(this->CurrentPlayer) {
@@ -402,12 +433,13 @@ bool StackMem::DoCheck(const bool HideCards) {
 
 			/* Clean up the played cards from the AI's mind. */
 			if (this->AIEnabled() && this->_AI && this->_AI->GetMethod() != StackMem::AIMethod::Random) {
-				this->_AI->EraseMind(this->GetCardType(this->PlayCards[0]), this->GetCardType(this->PlayCards[1]));
+				this->_AI->EraseMind(this->PlayCards[0], this->PlayCards[1]); // The mind stores indexes, not card types.
 			}
 
 			/* Set that we used and collected it. */
 			if (HideCards) {
-				this->SetCardCollected(this->PlayCards[0], true); this->SetCardCollected(this->PlayCards[1], true);
+				this->Gamefield[this->PlayCards[0]].Collected = true, this->Gamefield[this->PlayCards[1]].Collected = true;
+				this->ResetTurn(true);
 			}
 
 			return true;
@@ -419,7 +451,7 @@ bool StackMem::DoCheck(const bool HideCards) {
 
 			/* Optionally hide those automatically. This is set to false though on 3DZwei for animation purposes. */
 			if (HideCards) {
-				this->ResetTurn(false); // Hide the cards again.
+				this->ResetTurn(false); // Hide the cards again and end the turn.
 			}
 		}
 	}
@@ -437,15 +469,17 @@ bool StackMem::DoCheck(const bool HideCards) {
 	Returns true, if successfully played, or false if not.
 */
 bool StackMem::DoPlay(const size_t Idx) {
+	if (Idx >= this->GetPairs() * 2) return false; // Out of scope.
+
 	if (!this->IsCardShown(Idx)) { // Ensure the card is NOT shown.
 		if (this->GetState() == StackMem::TurnState::DrawFirst) { // If we are on the first card state -> Set to first.
-			this->SetCardShown(Idx, true);
+			this->Gamefield[Idx].Shown = true;
 			this->PlayCards[0] = Idx;
 			this->State = StackMem::TurnState::DrawSecond;
 			return true;
 
 		} else if (this->GetState() == StackMem::TurnState::DrawSecond) { // If we are on the second card state -> Set to second.
-			this->SetCardShown(Idx, true);
+			this->Gamefield[Idx].Shown = true;
 			this->PlayCards[1] = Idx;
 			this->State = StackMem::TurnState::DoCheck;
 			return true;
@@ -462,7 +496,7 @@ bool StackMem::DoPlay(const size_t Idx) {
 	const size_t Idx: The card-index.
 */
 int StackMem::GetCardType(const size_t Idx) const {
-	if (Idx > (this->GetPairs() * 2) - 1) return -1; // Out of scope.
+	if (Idx >= this->GetPairs() * 2) return -1; // Out of scope. NOTE: Don't subtract here, that underflows with 0 pairs.
 
 	return this->Gamefield[Idx].CardType;
 }
@@ -528,7 +562,7 @@ int StackMem::AIRandomMethod() {
 	}
 
 	/* Return a random index from the available indexes here. */
-	if (!AvlIndexes.empty()) return AvlIndexes[this->RandomEngine() % (AvlIndexes.size() - 1) + 0];
+	if (!AvlIndexes.empty()) return AvlIndexes[this->RandomEngine() % AvlIndexes.size()];
 	return -1;
 }
 
@@ -589,7 +623,7 @@ int StackMem::AIHardMethod() {
 			}
 		}
 
-		if (!AvlIndexes.empty()) return AvlIndexes[this->RandomEngine() % (AvlIndexes.size() - 1) + 0];
+		if (!AvlIndexes.empty()) return AvlIndexes[this->RandomEngine() % AvlIndexes.size()];
 	}
 
 	return this->AIRandomMethod(); // Do Random Method, cause either AI is not used, or no card matches for a proper play.
@@ -649,7 +683,7 @@ int StackMem::AIExtremeMethod() {
 				}
 			}
 
-			if (!AvlIndexes.empty()) return AvlIndexes[this->RandomEngine() % (AvlIndexes.size() - 1) + 0];
+			if (!AvlIndexes.empty()) return AvlIndexes[this->RandomEngine() % AvlIndexes.size()];
 
 			/* That should solve it for us. You ONLY need the Extreme Method on the DrawFirst State. */
 		} else if (this->GetState() == StackMem::TurnState::DrawSecond) return this->AIHardMethod();
@@ -723,14 +757,88 @@ StackMem::AIMethod StackMem::GetMethod() const {
 
 
 /*
-	Resets a turn by resetting the Playcards and set to hidden
+	Resets a turn by resetting the Playcards and set to hidden. The State is StackMem::TurnState::DrawFirst afterwards.
+	A pair, which DoCheck already counted, gets collected either way, so the Pairs still match up.
 
 	const bool Correct: If the card was correct (true, doesn't set the status to hidden) or not (false, hide the card).
 */
 void StackMem::ResetTurn(const bool Correct) {
-	if (!Correct) {
-		this->SetCardShown(this->PlayCards[0], false); this->SetCardShown(this->PlayCards[1], false);
+	const bool Pair = (this->Checked && this->CheckMatch());
+
+	for (size_t Idx = 0; Idx < 2; Idx++) {
+		if (this->PlayCards[Idx] == -1) continue;
+		CardStruct &Card = this->Gamefield[this->PlayCards[Idx]];
+
+		if (Pair) Card.Collected = true;
+		else if (!Correct && !Card.Collected) Card.Shown = false;
 	}
 
 	this->PlayCards[0] = -1, this->PlayCards[1] = -1;
+	this->State = StackMem::TurnState::DrawFirst;
+	this->Checked = false;
+}
+
+
+/*
+	Checks, if the Game is in a consistent state.
+
+	The setters like SetCardShown, SetCardCollected or SetState use this to refuse changes, that would bring the game into a
+	state that can't happen through normal play.
+
+	Returns true, if all of the following is fine:
+		- The Gamefield has exactly 2 cards of each CardType from 0 to Pairs - 1.
+		- Collected cards are shown. A card can only be collected without its partner, while its pair is being collected.
+		- The collected pairs of both players match the collected cards, plus the pair DoCheck counted but isn't collected yet.
+		- The play cards are in range and shown, and match the current TurnState.
+*/
+bool StackMem::CheckIntegrity() const {
+	if (this->Gamefield.size() != this->GetPairs() * 2) return false;
+
+	/* The played cards of a pair, which DoCheck already counted. */
+	const bool Pair = (this->Checked && this->CheckMatch());
+	const int PairType = (Pair ? this->Gamefield[this->PlayCards[0]].CardType : -1);
+
+	std::vector<uint8_t> TypeCount(this->GetPairs(), 0), CollectCount(this->GetPairs(), 0);
+
+	for (size_t Idx = 0; Idx < this->Gamefield.size(); Idx++) {
+		const int Type = this->Gamefield[Idx].CardType;
+		if (Type < 0 || Type >= (int)this->GetPairs() || ++TypeCount[Type] > 2) return false;
+
+		if (this->Gamefield[Idx].Collected) {
+			if (!this->Gamefield[Idx].Shown) return false;
+			CollectCount[Type]++;
+		}
+	}
+
+	size_t Collected = 0;
+	for (size_t Type = 0; Type < CollectCount.size(); Type++) {
+		if (CollectCount[Type] == 2) Collected++;
+		else if (CollectCount[Type] == 1 && (int)Type != PairType) return false;
+	}
+
+	const bool PairOpen = (Pair && CollectCount[PairType] < 2);
+	if (this->PlayerPairs[0] + this->PlayerPairs[1] != Collected + (PairOpen ? 1 : 0)) return false;
+
+	/* Ensure the play cards are either -1 or valid and shown. */
+	for (size_t Idx = 0; Idx < 2; Idx++) {
+		if (this->PlayCards[Idx] == -1) continue;
+		if (this->PlayCards[Idx] < 0 || this->PlayCards[Idx] >= (int)this->Gamefield.size()) return false;
+		if (!this->Gamefield[this->PlayCards[Idx]].Shown) return false;
+	}
+
+	switch(this->GetState()) {
+		case StackMem::TurnState::DrawFirst:
+			if (this->PlayCards[0] != -1 || this->PlayCards[1] != -1 || this->Checked) return false;
+			break;
+
+		case StackMem::TurnState::DrawSecond:
+			if (this->PlayCards[0] == -1 || this->PlayCards[1] != -1 || this->Checked) return false;
+			break;
+
+		case StackMem::TurnState::DoCheck:
+			if (this->PlayCards[0] == -1 || this->PlayCards[1] == -1 || this->PlayCards[0] == this->PlayCards[1]) return false;
+			break;
+	}
+
+	return true;
 }
\ No newline at end of file
@@ -0,0 +1,172 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "Animator.hpp"
+#include <utility> // std::move.
+
+
+/*
+	Applies the easing curve.
+
+	const Ease Type: The easing curve.
+	const float T: The progress from 0.0f to 1.0f.
+*/
+float Animator::Apply(const Ease Type, const float T) {
+	switch(Type) {
+		case Ease::Linear:
+			return T;
+
+		case Ease::OutQuad:
+			return 1.0f - (1.0f - T) * (1.0f - T);
+
+		case Ease::OutCubic:
+			return 1.0f - (1.0f - T) * (1.0f - T) * (1.0f - T);
+
+		case Ease::InOutCubic:
+			return (T < 0.5f ? 4.0f * T * T * T : 1.0f - (-2.0f * T + 2.0f) * (-2.0f * T + 2.0f) * (-2.0f * T + 2.0f) / 2.0f);
+	}
+
+	return T;
+}
+
+
+/*
+	Adds a tween.
+
+	float &Value: Reference to the value to animate. It MUST outlive the tween.
+	const float From: The start value. It's set directly.
+	const float To: The end value.
+	const uint32_t Frames: The duration in frames. 0 finishes the tween directly, including the callback.
+	const Ease Type: The easing curve.
+	const std::function<void()> &Done: Called, once the tween finished or got canceled with finishing.
+	const uint8_t Group: The group of the tween, for canceling multiple tweens at once.
+	const uint32_t Delay: The frames to wait before starting.
+*/
+void Animator::Add(float &Value, const float From, const float To, const uint32_t Frames, const Ease Type, const std::function<void()> &Done, const uint8_t Group, const uint32_t Delay) {
+	if (Frames == 0 && Delay == 0) {
+		Value = To;
+		if (Done) Done();
+		return;
+	}
+
+	Value = From;
+	this->Tweens.push_back({ &Value, From, To, (float)Frames, 0.0f, (float)Delay, this->Ticks, Type, Group, Done });
+}
+
+
+/*
+	Removes a tween and optionally calls its callback.
+	The tween is removed before the callback, so it can safely add new tweens.
+
+	const size_t Idx: The index in the tween list.
+	const bool CallDone: If the tween should jump to its end value and call its callback.
+*/
+void Animator::Finish(const size_t Idx, const bool CallDone) {
+	const std::function<void()> Done = this->Tweens[Idx].Done;
+	if (CallDone) *this->Tweens[Idx].Value = this->Tweens[Idx].To;
+
+	this->Tweens.erase(this->Tweens.begin() + Idx);
+	if (CallDone && Done) Done();
+}
+
+
+/*
+	Cancels all tweens of a group.
+	They are all removed first and their callbacks are called afterwards, so tweens which those callbacks add
+	(even to the same group) run normally.
+
+	const uint8_t Group: The group to cancel.
+	const bool Finish: If the tweens should jump to their end values and call their callbacks.
+*/
+void Animator::CancelGroup(const uint8_t Group, const bool Finish) {
+	std::vector<Tween> Canceled;
+	size_t Keep = 0;
+
+	for (size_t Idx = 0; Idx < this->Tweens.size(); Idx++) {
+		if (this->Tweens[Idx].Group == Group) Canceled.push_back(std::move(this->Tweens[Idx]));
+		else {
+			if (Keep != Idx) this->Tweens[Keep] = std::move(this->Tweens[Idx]);
+			Keep++;
+		}
+	}
+
+	this->Tweens.erase(this->Tweens.begin() + Keep, this->Tweens.end());
+	if (!Finish) return;
+
+	for (const Tween &T : Canceled) {
+		*T.Value = T.To;
+		if (T.Done) T.Done();
+	}
+}
+
+
+bool Animator::GroupActive(const uint8_t Group) const {
+	for (const Tween &T : this->Tweens) {
+		if (T.Group == Group) return true;
+	}
+
+	return false;
+}
+
+
+/*
+	Advances all tweens and calls the callbacks of the finished ones.
+
+	const float Frames: The passed 60 FPS frames since the last tick, see Clock::Frames().
+*/
+void Animator::Tick(const float Frames) {
+	this->Ticks++;
+
+	for (size_t Idx = 0; Idx < this->Tweens.size();) {
+		Tween &T = this->Tweens[Idx];
+
+		if (T.Born == this->Ticks) { // Added by a callback during this tick.
+			Idx++;
+			continue;
+		}
+
+		float Step = Frames;
+		if (T.Delay > 0.0f) { // The rest of the step goes into the tween, once the delay is over.
+			T.Delay -= Step;
+
+			if (T.Delay > 0.0f) {
+				Idx++;
+				continue;
+			}
+
+			Step = -T.Delay, T.Delay = 0.0f;
+		}
+
+		T.Elapsed += Step;
+		if (T.Elapsed >= T.Frames) {
+			this->Finish(Idx, true);
+			continue;
+		}
+
+		*T.Value = T.From + (T.To - T.From) * Apply(T.Type, T.Elapsed / T.Frames);
+		Idx++;
+	}
+}
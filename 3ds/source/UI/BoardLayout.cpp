@@ -0,0 +1,170 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "BoardLayout.hpp"
+#include <algorithm> // std::lower_bound, std::min, std::max.
+#include <cmath> // std::floor.
+
+/* The area between both page buttons and the native card size. */
+#define BOARD_X     20
+#define BOARD_Y      0
+#define BOARD_W    280
+#define BOARD_H    240
+#define CARD_SIZE   55
+
+
+/*
+	The diagonals of a grid, generated at compile time.
+
+	Slots: All slots of the grid, sorted by their diagonal (Row + Col) and then by their row, so every diagonal is ascending.
+	Start: The index in Slots, where a diagonal starts. The last entry is the end of the last diagonal.
+*/
+template <uint8_t Cols, uint8_t Rows>
+struct WaveTable {
+	uint8_t Slots[Cols * Rows] = { };
+	uint8_t Start[Cols + Rows] = { };
+
+	constexpr WaveTable() {
+		uint8_t Pos = 0;
+
+		for (uint8_t Diag = 0; Diag < Cols + Rows - 1; Diag++) {
+			this->Start[Diag] = Pos;
+
+			for (uint8_t Row = 0; Row < Rows; Row++) {
+				if (Diag >= Row && Diag - Row < Cols) this->Slots[Pos++] = (Row * Cols) + (Diag - Row);
+			}
+		}
+
+		this->Start[Cols + Rows - 1] = Pos;
+	}
+};
+
+static constexpr WaveTable<5, 4> NormalWaves;
+static constexpr WaveTable<6, 4> DenseWaves;
+static constexpr WaveTable<8, 5> DenserWaves;
+
+/* The bottom right card falls first and the top left card last, like the old 5x4 tables. */
+static_assert(NormalWaves.Slots[19] == 19 && NormalWaves.Slots[18] == 18 && NormalWaves.Slots[17] == 14 && NormalWaves.Slots[0] == 0);
+static_assert(NormalWaves.Start[7] == 19 && NormalWaves.Start[8] == 20);
+
+
+/*
+	Constructor of the BoardLayout.
+
+	const BoardLayout::Grid G: The grid preset.
+*/
+BoardLayout::BoardLayout(const BoardLayout::Grid G) {
+	switch(G) {
+		case BoardLayout::Grid::Normal:
+			this->VCols = 5, this->VRows = 4;
+			this->WaveSlots = NormalWaves.Slots, this->WaveStart = NormalWaves.Start;
+			break;
+
+		case BoardLayout::Grid::Dense:
+			this->VCols = 6, this->VRows = 4;
+			this->WaveSlots = DenseWaves.Slots, this->WaveStart = DenseWaves.Start;
+			break;
+
+		case BoardLayout::Grid::Denser:
+			this->VCols = 8, this->VRows = 5;
+			this->WaveSlots = DenserWaves.Slots, this->WaveStart = DenserWaves.Start;
+			break;
+	}
+
+	/* Full pixels only, so the cards stay sharp. */
+	this->Pitch = std::floor(std::fmin((float)BOARD_W / this->VCols, (float)BOARD_H / this->VRows));
+	this->OriginX = BOARD_X + std::floor((BOARD_W - this->Pitch * this->VCols) / 2) + 0.5f;
+	this->OriginY = BOARD_Y + std::floor((BOARD_H - this->Pitch * this->VRows) / 2) + 0.5f;
+}
+
+
+/* The scale of the card sprites, so they fit into their cell. */
+float BoardLayout::Scale() const { return (this->Pitch - 1.0f) / CARD_SIZE; }
+
+
+/*
+	Returns the rectangle of a card on the page.
+
+	const size_t Slot: The index of the card on the page.
+*/
+BoardLayout::Rect BoardLayout::Card(const size_t Slot) const {
+	return {
+		this->OriginX + (Slot % this->VCols) * this->Pitch,
+		this->OriginY + (Slot / this->VCols) * this->Pitch,
+		this->Pitch - 1.0f,
+		this->Pitch - 1.0f
+	};
+}
+
+
+/*
+	Returns the index of the card on the page at a position, or -1 if no card is there.
+
+	const float X: The X-Position, like the touch or the pointer position.
+	const float Y: The Y-Position, like the touch or the pointer position.
+*/
+int BoardLayout::Slot(const float X, const float Y) const {
+	const float RelX = X - this->OriginX, RelY = Y - this->OriginY;
+	if (RelX < 0.0f || RelY < 0.0f) return -1;
+
+	const int Col = (int)(RelX / this->Pitch), Row = (int)(RelY / this->Pitch);
+	if (Col >= this->VCols || Row >= this->VRows) return -1;
+
+	/* Check the card itself, the gap between the cards doesn't count. */
+	if (RelX - Col * this->Pitch > this->Pitch - 1.0f || RelY - Row * this->Pitch > this->Pitch - 1.0f) return -1;
+	return (Row * this->VCols) + Col;
+}
+
+
+/*
+	Returns the amount of waves of the Start Animation.
+
+	const size_t Cards: The amount of cards on the page.
+*/
+size_t BoardLayout::WaveCount(const size_t Cards) const {
+	if (Cards == 0) return 0;
+	const size_t Last = std::min(Cards, this->PerPage()) - 1, Row = Last / this->VCols, Col = Last % this->VCols;
+
+	/* The farthest diagonal is either the one of the last card, or the end of the full row above. */
+	return (Row > 0 ? std::max(Row + Col, Row - 1 + this->VCols - 1) : Col) + 1;
+}
+
+
+/*
+	Returns the slots of a wave of the Start Animation.
+
+	const size_t Idx: The index of the wave. 0 is the first falling wave.
+	const size_t Cards: The amount of cards on the page.
+*/
+std::span<const uint8_t> BoardLayout::Wave(const size_t Idx, const size_t Cards) const {
+	const size_t Count = this->WaveCount(Cards);
+	if (Idx >= Count) return { };
+
+	const size_t Diag = Count - 1 - Idx;
+	const uint8_t *Begin = this->WaveSlots + this->WaveStart[Diag], *End = this->WaveSlots + this->WaveStart[Diag + 1];
+
+	return { Begin, std::lower_bound(Begin, End, Cards) }; // Cut off the slots without a card.
+}
@@ -0,0 +1,56 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "CachedLayer.hpp"
+#include "Common.hpp"
+
+
+/*
+	Draws the layer on a screen, and renders it first, if the inputs changed.
+	Call this within GFX::BeginFrame() and GFX::EndFrame().
+
+	C3D_RenderTarget *Screen: The screen to draw on.
+	const CachedLayer::Key &Inputs: All values, which change the content of the layer.
+	const std::function<void()> &Render: Draws the content of the layer.
+*/
+void CachedLayer::Draw(C3D_RenderTarget *Screen, const CachedLayer::Key &Inputs, const std::function<void()> &Render) {
+	if (!this->Tex.Init()) { // No texture available, so draw it directly.
+		Render();
+		return;
+	}
+
+	if (!this->Valid || Inputs != this->LastInputs) {
+		C2D_TargetClear(this->Tex.Target(), C2D_Color32(0, 0, 0, 0));
+		C3D_RenderTarget *Prev = GFX::Redirect(Screen, this->Tex.Target());
+		Render();
+		GFX::Redirect(Screen, Prev);
+
+		this->LastInputs = Inputs, this->Valid = true;
+	}
+
+	GFX::ScreenDraw(Screen);
+	this->Tex.Draw(0, 0);
+}
@@ -25,12 +25,38 @@
 */
 
 #include "GFX.hpp"
+#include "Input.hpp" // Playback keeps the full frame rate.
 #include "screenCommon.hpp"
 #include "Utils.hpp"
+#include <atomic> // The game logic invalidates from its own thread.
+#include <unordered_map>
+
+#define TEXT_BUF_GLYPHS   4096 // Glyphs of the text cache buffer.
+#define TEXT_CACHE_MAX     256 // Texts in the cache, before it gets cleared.
+#define IDLE_AFTER         120 // Steps without a change (2 seconds), before the loop slows down.
+#define IDLE_VBLANKS         2 // VBlanks per step while idle, so input is still polled at 30 FPS.
+#define TICKS_PER_MS     (SYSCLOCK_ARM11 / 1000.0f)
 
 /* All used Spritesheets. */
 C2D_SpriteSheet GFX::Cards = nullptr, GFX::Characters = nullptr, GFX::Sprites = nullptr;
 
+static std::atomic<bool> Dirty = true; // If the screens need to be redrawn.
+static std::atomic<uint32_t> IdleSteps = 0; // The loop steps since the last invalidation.
+static GFX::FrameStats Frames;
+static uint64_t FrameStart = 0;
+static bool OnTop = true; // The current screen, for centering text.
+static C3D_RenderTarget *TopRedirect = nullptr, *BottomRedirect = nullptr; // Draws into a texture instead of a screen.
+
+/*
+	The text cache. Parsing a string and getting its size is expensive, so the parsed texts stay in their own buffer
+	across frames. The key is the final string, so a changed dynamic value simply becomes a new entry.
+
+	float Width, Height: The size at scale 1.0f, so it only needs to be scaled with the text size.
+*/
+struct CachedText { C2D_Text Text; float Width; float Height; };
+static C2D_TextBuf TextBuf = nullptr;
+static std::unordered_map<std::string, CachedText> TextCache;
+
 
 /* Load all Spritesheets. */
 void GFX::LoadSheets() {
@@ -46,9 +72,118 @@ void GFX::UnloadSheets() {
 }
 
 
+/*
+	Marks the screens as changed, so the next frame gets drawn. This also ends the low power mode.
+	Input, animation steps (Clock::Lerp / Clock::Step) and pointer moves already do this.
+*/
+void GFX::Invalidate() { Dirty = true, IdleSteps = 0; }
+
+
+/*
+	Returns, if the screens got invalidated since the last call, and resets that.
+	A logic thread uses this to only publish a new frame snapshot, if something changed.
+*/
+bool GFX::Changed() { return Dirty.exchange(false); }
+
+
+/*
+	Begins a frame, if something changed since the last drawn one.
+	Otherwise this only waits for the VBlank, so the loop keeps its pace without drawing.
+
+	Returns true, if the frame should be drawn and GFX::EndFrame() called afterwards.
+*/
+bool GFX::BeginFrame() { return GFX::BeginFrame(GFX::Changed()); }
+
+
+/*
+	Begins a frame, if the caller tracks the changes itself, like a render thread with new frame snapshots.
+
+	const bool Draw: If the frame should be drawn.
+*/
+bool GFX::BeginFrame(const bool Draw) {
+	if (!Draw) { // The screens still show the last frame.
+		/*
+			If nothing changed for a while, the loop only polls every few VBlanks to save battery.
+			An invalidation, like from the input of the next poll or from a logic thread, ends that right away.
+		*/
+		const bool Idle = (IdleSteps++ >= IDLE_AFTER && !Input::Playback());
+		uint8_t VBlanks = (Idle ? IDLE_VBLANKS : 1);
+
+		do {
+			gspWaitForVBlank();
+		} while(--VBlanks > 0 && IdleSteps > 0);
+
+		Frames.Skipped++;
+		if (Idle) Frames.Idle++;
+		return false;
+	}
+
+	IdleSteps = 0;
+	FrameStart = svcGetSystemTick();
+
+	Gui::clearTextBufs();
+	C2D_TargetClear(Top, C2D_Color32(0, 0, 0, 0));
+	C2D_TargetClear(Bottom, C2D_Color32(0, 0, 0, 0));
+	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+	return true;
+}
+
+
+/* Ends a frame, which got started with GFX::BeginFrame(). */
+void GFX::EndFrame() {
+	C3D_FrameEnd(0);
+
+	/* Running average, so it doesn't overflow on long sessions. */
+	const float Ms = (svcGetSystemTick() - FrameStart) / TICKS_PER_MS;
+	Frames.Drawn++;
+	Frames.AvgMs += (Ms - Frames.AvgMs) / Frames.Drawn;
+	if (Ms > Frames.MaxMs) Frames.MaxMs = Ms;
+}
+
+
+/* Returns the frame statistics. Only call this from the render loop. */
+GFX::FrameStats GFX::GetFrameStats() { return Frames; }
+
+
+/* Resets the frame statistics, like before a benchmark. */
+void GFX::ResetFrameStats() { Frames = { }; }
+
+
+/*
+	Focuses the drawing on a screen. Use this instead of Gui::ScreenDraw(), so the cached text centering knows the screen.
+
+	C3D_RenderTarget *Screen: The screen to draw on.
+*/
+void GFX::ScreenDraw(C3D_RenderTarget *Screen) {
+	if (Screen == Top && TopRedirect) Gui::ScreenDraw(TopRedirect);
+	else if (Screen == Bottom && BottomRedirect) Gui::ScreenDraw(BottomRedirect);
+	else Gui::ScreenDraw(Screen);
+
+	OnTop = (Screen == Top);
+}
+
+
+/*
+	Redirects the drawing of a screen to an other render target, like a RenderTexture.
+
+	C3D_RenderTarget *Screen: The screen to redirect (Top or Bottom).
+	C3D_RenderTarget *Target: The target to draw on instead, or nullptr to stop redirecting.
+
+	Returns the previous target, so nested redirects can restore it.
+*/
+C3D_RenderTarget *GFX::Redirect(C3D_RenderTarget *Screen, C3D_RenderTarget *Target) {
+	C3D_RenderTarget *Prev = nullptr;
+
+	if (Screen == Top) Prev = TopRedirect, TopRedirect = Target;
+	else if (Screen == Bottom) Prev = BottomRedirect, BottomRedirect = Target;
+
+	return Prev;
+}
+
+
 /* Draws the Top Screen base. */
 void GFX::DrawTop() {
-	Gui::ScreenDraw(Top);
+	GFX::ScreenDraw(Top);
 	Gui::Draw_Rect(0, 0, 400, 25, BAR_BLUE);
 	Gui::Draw_Rect(0, 25, 400, 215, BG_BLUE);
 }
@@ -56,7 +191,7 @@ void GFX::DrawTop() {
 
 /* Draws the Bottom Screen base. */
 void GFX::DrawBottom() {
-	Gui::ScreenDraw(Bottom);
+	GFX::ScreenDraw(Bottom);
 	Gui::Draw_Rect(0, 0, 320, 240, BG_BLUE);
 }
 
@@ -111,4 +246,170 @@ void GFX::DrawCheckbox(const int PosX, const int PosY, const bool Checked, const
 */
 void GFX::DrawCard(const size_t Idx, const int X, const int Y, const float ScaleX, const float ScaleY) {
 	if (Idx <= Utils::Cards.size()) Gui::DrawSprite(GFX::Cards, Utils::Cards[Idx], X, Y, ScaleX, ScaleY);
-}
\ No newline at end of file
+}
+
+
+/*
+	Adds a card to the batch.
+
+	const size_t Idx: The sprite index of the sheet.
+	const float X: The X-Position of the card.
+	const float Y: The Y-Position of the card.
+	const float ScaleX: The X-Scale of the card.
+	const float ScaleY: The Y-Scale of the card.
+*/
+void GFX::CardBatch::Add(const size_t Idx, const float X, const float Y, const float ScaleX, const float ScaleY) {
+	this->Fronts.push_back({ Idx, X, Y, ScaleX, ScaleY });
+}
+
+
+/*
+	Adds a back cover to the batch.
+
+	const float X: The X-Position of the card.
+	const float Y: The Y-Position of the card.
+	const float ScaleX: The X-Scale of the card.
+	const float ScaleY: The Y-Scale of the card.
+*/
+void GFX::CardBatch::AddBack(const float X, const float Y, const float ScaleX, const float ScaleY) {
+	this->Backs.push_back({ 0, X, Y, ScaleX, ScaleY });
+}
+
+
+/*
+	Draws all collected cards on the current screen and clears the batch.
+
+	The images are fetched at drawing time and not kept, because a reloaded card set can get the same sheet address.
+
+	C2D_SpriteSheet Sheet: The sprite sheet of the cards.
+*/
+void GFX::CardBatch::Draw(C2D_SpriteSheet Sheet) {
+	const size_t Count = (Sheet ? C2D_SpriteSheetCount(Sheet) : 0);
+
+	if (Count > 0) {
+		if (!this->Backs.empty()) {
+			const C2D_Image Back = C2D_SpriteSheetGetImage(Sheet, Count - 1);
+			for (const Instance &Card : this->Backs) C2D_DrawImageAt(Back, Card.X, Card.Y, 0.5f, nullptr, Card.ScaleX, Card.ScaleY);
+		}
+
+		for (const Instance &Card : this->Fronts) {
+			if (Card.Idx < Count) C2D_DrawImageAt(C2D_SpriteSheetGetImage(Sheet, Card.Idx), Card.X, Card.Y, 0.5f, nullptr, Card.ScaleX, Card.ScaleY);
+		}
+	}
+
+	this->Clear();
+}
+
+
+/* Removes all collected cards without drawing them. */
+void GFX::CardBatch::Clear() { this->Fronts.clear(), this->Backs.clear(); }
+
+/*
+	Returns true, if the cache can't take another text without clearing it first.
+
+	const size_t Glyphs: The glyphs of the text, the byte size is always at least the glyph count.
+*/
+static bool TextFull(const size_t Glyphs) {
+	return (TextCache.size() >= TEXT_CACHE_MAX || (TextBuf && C2D_TextBufGetNumGlyphs(TextBuf) + Glyphs > TEXT_BUF_GLYPHS));
+}
+
+
+/*
+	Returns the cached text of a string and parses it, if it isn't cached yet.
+	If the buffer or the cache is full, everything gets cleared first.
+
+	const std::string &Text: The string.
+*/
+static const CachedText &GetText(const std::string &Text) {
+	const auto It = TextCache.find(Text);
+	if (It != TextCache.end()) return It->second;
+
+	if (!TextBuf) TextBuf = C2D_TextBufNew(TEXT_BUF_GLYPHS);
+	if (TextFull(Text.size())) GFX::ClearTextCache();
+
+	CachedText Entry;
+	C2D_TextFontParse(&Entry.Text, nullptr, TextBuf, Text.c_str());
+	C2D_TextOptimize(&Entry.Text);
+	C2D_TextGetDimensions(&Entry.Text, 1.0f, 1.0f, &Entry.Width, &Entry.Height);
+
+	return TextCache.emplace(Text, Entry).first->second;
+}
+
+
+/*
+	Draws a cached text. Behaves like GFX::DrawString().
+
+	const float X: The X-Position where to draw the text.
+	const float Y: The Y-Position where to draw the text.
+	const float Size: The size of the text.
+	const uint32_t Color: The color of the text.
+	const std::string &Text: The text to draw.
+	const int MaxWidth: The max width, the text gets scaled down or wrapped to fit (0 for none).
+	const int MaxHeight: The max height, the text gets scaled down to fit (0 for none).
+	C2D_Font Fnt: A custom font. Those are not cached and drawn with GFX::DrawString().
+	const int Flags: The C2D text flags.
+*/
+void GFX::DrawString(const float X, const float Y, const float Size, const uint32_t Color, const std::string &Text, const int MaxWidth, const int MaxHeight, C2D_Font Fnt, const int Flags) {
+	if (Fnt) {
+		Gui::DrawString(X, Y, Size, Color, Text, MaxWidth, MaxHeight, Fnt, Flags);
+		return;
+	}
+
+	if (Text.empty()) return;
+	const CachedText &Entry = GetText(Text);
+	const float Width = Entry.Width * Size, Height = Entry.Height * Size;
+	const float HeightScale = ((MaxHeight == 0 || Height <= 0.0f) ? Size : std::min(Size, Size * (MaxHeight / Height)));
+
+	if (MaxWidth == 0) C2D_DrawText(&Entry.Text, C2D_WithColor | Flags, X, Y, 0.5f, Size, HeightScale, Color);
+	else if (Flags & C2D_WordWrap) C2D_DrawText(&Entry.Text, C2D_WithColor | Flags, X, Y, 0.5f, Size, HeightScale, Color, (float)MaxWidth);
+	else C2D_DrawText(&Entry.Text, C2D_WithColor | Flags, X, Y, 0.5f, (Width <= 0.0f ? Size : std::min(Size, Size * (MaxWidth / Width))), HeightScale, Color);
+}
+
+
+/*
+	Draws a cached text centered on the current screen. Behaves like GFX::DrawStringCentered().
+	The parameters are the same as for GFX::DrawString(), X is the offset from the center.
+*/
+void GFX::DrawStringCentered(const float X, const float Y, const float Size, const uint32_t Color, const std::string &Text, const int MaxWidth, const int MaxHeight, C2D_Font Fnt, const int Flags) {
+	if (Fnt) {
+		Gui::DrawStringCentered(X, Y, Size, Color, Text, MaxWidth, MaxHeight, Fnt, Flags);
+		return;
+	}
+
+	if (Text.empty()) return;
+	const float Width = GetText(Text).Width * Size;
+	GFX::DrawString(X + (OnTop ? 200 : 160) - ((MaxWidth == 0 ? Width : std::min((float)MaxWidth, Width)) / 2), Y, Size, Color, Text, MaxWidth, MaxHeight, nullptr, Flags);
+}
+
+
+/*
+	Parses a text into the cache ahead of time, so its first draw doesn't have to look up its glyphs.
+	Returns false, if the cache is too full to take it without clearing the texts of the current screen.
+
+	const std::string &Text: The string.
+*/
+bool GFX::CacheText(const std::string &Text) {
+	if (Text.empty() || TextCache.count(Text)) return true;
+	if (TextFull(Text.size())) return false;
+
+	GetText(Text);
+	return true;
+}
+
+
+/* Clears the text cache, like when the language changed. */
+void GFX::ClearTextCache() {
+	TextCache.clear();
+	if (TextBuf) C2D_TextBufClear(TextBuf);
+}
+
+
+/* Frees the text cache. */
+void GFX::UnloadText() {
+	TextCache.clear();
+
+	if (TextBuf) {
+		C2D_TextBufDelete(TextBuf);
+		TextBuf = nullptr;
+	}
+}
@@ -0,0 +1,75 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "PageGrid.hpp"
+
+
+/*
+	Constructor of the PageGrid.
+
+	const std::vector<FuncCallback> &Cells: The callback positions, which contain the cells of a page.
+	const size_t First: The index of the first cell in Cells.
+	const size_t PerPage: The cells of a page.
+	const uint16_t Width: The width of the screen the grid is drawn on.
+	const uint16_t Height: The height of the screen the grid is drawn on.
+*/
+PageGrid::PageGrid(const std::vector<FuncCallback> &Cells, const size_t First, const size_t PerPage, const uint16_t Width, const uint16_t Height)
+	: Cells(Cells), First(First), Slots(PerPage), Width(Width), Height(Height) { }
+
+
+/*
+	Returns the item index of a cell, or -1 if the item doesn't exist.
+
+	const size_t Page: The page of the cell.
+	const size_t Slot: The cell of the page.
+*/
+int PageGrid::Index(const size_t Page, const size_t Slot) const {
+	if (Slot >= this->Slots) return -1;
+
+	const size_t Idx = (Page * this->Slots) + Slot;
+	return (Idx < this->Items ? (int)Idx : -1);
+}
+
+
+/*
+	Calls a function for each item of a page, which is visible on the screen.
+
+	const size_t Page: The page to draw.
+	const float OffsX: The horizontal offset of the page, like from a swipe.
+	const float OffsY: The vertical offset of the page.
+	const std::function<...> &Func: Called with the item index, its cell and its position with the offset.
+*/
+void PageGrid::Draw(const size_t Page, const float OffsX, const float OffsY, const std::function<void(const size_t Idx, const size_t Slot, const float X, const float Y)> &Func) const {
+	if (!this->HasPage(Page) || OffsX <= -this->Width || OffsX >= this->Width || OffsY <= -this->Height || OffsY >= this->Height) return;
+
+	for (size_t Slot = 0, Idx = Page * this->Slots; Slot < this->Slots && Idx < this->Items; Slot++, Idx++) {
+		const FuncCallback &Cell = this->Cells[this->First + Slot];
+		const float X = Cell.X + OffsX, Y = Cell.Y + OffsY;
+
+		if (X + Cell.W <= 0 || X >= this->Width || Y + Cell.H <= 0 || Y >= this->Height) continue; // Out of the screen.
+		Func(Idx, Slot, X, Y);
+	}
+}
@@ -0,0 +1,109 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "Particles.hpp"
+#include "screenCommon.hpp"
+#include <algorithm> // std::min.
+#include <cmath> // std::cos, std::sin, std::pow.
+#include <cstdlib> // rand().
+
+#define GRAVITY    0.12f // Per 60 FPS frame.
+#define DRAG       0.98f // Per 60 FPS frame.
+#define FADE_TIME 15.0f // The last frames of a particle fade it out.
+
+
+/*
+	Spawns particles, which fly apart from a point in random directions.
+
+	const float X: The X-Position to spawn at.
+	const float Y: The Y-Position to spawn at.
+	const size_t Amount: The amount of particles. Only the free slots of the pool are used.
+	const float Speed: The maximal start speed in pixels per 60 FPS frame.
+	const uint32_t *Colors: The colors to pick from.
+	const size_t ColorCount: The amount of colors.
+*/
+void Particles::Burst(const float X, const float Y, const size_t Amount, const float Speed, const uint32_t *Colors, const size_t ColorCount) {
+	const size_t End = std::min(this->Count + Amount, MAX);
+
+	for (size_t Idx = this->Count; Idx < End; Idx++) {
+		const float Angle = (rand() % 628) / 100.0f, Vel = Speed * (0.3f + (rand() % 70) / 100.0f);
+
+		this->X[Idx] = X, this->Y[Idx] = Y;
+		this->VX[Idx] = std::cos(Angle) * Vel;
+		this->VY[Idx] = std::sin(Angle) * Vel - Speed / 2; // A bit upwards, before they fall down.
+		this->Life[Idx] = 40 + rand() % 40;
+		this->Size[Idx] = 2 + rand() % 4;
+		this->Color[Idx] = Colors[rand() % ColorCount];
+	}
+
+	this->Count = End;
+}
+
+
+/*
+	Moves all particles and removes the expired ones. Dead particles are replaced by the last one, so the alive ones stay packed.
+
+	const float Frames: The passed frames, like Clock::Frames().
+*/
+void Particles::Tick(const float Frames) {
+	const float Drag = std::pow(DRAG, Frames);
+
+	for (size_t Idx = 0; Idx < this->Count;) {
+		this->Life[Idx] -= Frames;
+
+		if (this->Life[Idx] <= 0.0f) {
+			this->Count--;
+			this->X[Idx] = this->X[this->Count], this->Y[Idx] = this->Y[this->Count];
+			this->VX[Idx] = this->VX[this->Count], this->VY[Idx] = this->VY[this->Count];
+			this->Life[Idx] = this->Life[this->Count], this->Size[Idx] = this->Size[this->Count];
+			this->Color[Idx] = this->Color[this->Count];
+			continue; // The moved particle gets updated at this slot.
+		}
+
+		this->VX[Idx] *= Drag;
+		this->VY[Idx] = this->VY[Idx] * Drag + GRAVITY * Frames;
+		this->X[Idx] += this->VX[Idx] * Frames;
+		this->Y[Idx] += this->VY[Idx] * Frames;
+		Idx++;
+	}
+}
+
+
+/*
+	Draws all particles on the current screen.
+	They're untextured rectangles only, so citro2d keeps them all in one draw call.
+*/
+void Particles::Draw() const {
+	for (size_t Idx = 0; Idx < this->Count; Idx++) {
+		uint32_t Clr = this->Color[Idx];
+
+		if (this->Life[Idx] < FADE_TIME) { // Fade out by scaling the alpha, which is the highest byte.
+			Clr = (Clr & 0x00FFFFFF) | ((uint32_t)((Clr >> 24) * (this->Life[Idx] / FADE_TIME)) << 24);
+		}
+
+		Gui::Draw_Rect(this->X[Idx], this->Y[Idx], this->Size[Idx], this->Size[Idx], Clr);
+	}
+}
@@ -0,0 +1,82 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "RenderTexture.hpp"
+
+
+/* Frees the texture and the render target. */
+RenderTexture::~RenderTexture() {
+	if (this->VTarget) {
+		C3D_RenderTargetDelete(this->VTarget);
+		C3D_TexDelete(&this->Tex);
+	}
+}
+
+
+/*
+	Creates the texture and its render target, if not done yet.
+	Returns false, if there's not enough VRAM.
+*/
+bool RenderTexture::Init() {
+	if (this->VTarget) return true;
+
+	uint16_t TexW = 8, TexH = 8;
+	while (TexW < this->Width) TexW <<= 1;
+	while (TexH < this->Height) TexH <<= 1;
+
+	if (!C3D_TexInitVRAM(&this->Tex, TexW, TexH, GPU_RGBA8)) return false;
+	C3D_TexSetFilter(&this->Tex, GPU_NEAREST, GPU_NEAREST); // Pixel exact.
+
+	this->VTarget = C3D_RenderTargetCreateFromTex(&this->Tex, GPU_TEXFACE_2D, 0, -1);
+	if (!this->VTarget) {
+		C3D_TexDelete(&this->Tex);
+		return false;
+	}
+
+	this->SubTex = { this->Width, this->Height, 0.0f, 1.0f, (float)this->Width / TexW, 1.0f - ((float)this->Height / TexH) };
+	return true;
+}
+
+
+/*
+	Draws the texture on the current screen.
+
+	const float X: The X-Position where to draw.
+	const float Y: The Y-Position where to draw.
+	const float Alpha: The opacity (0.0f up to 1.0f), for crossfades.
+*/
+void RenderTexture::Draw(const float X, const float Y, const float Alpha) {
+	if (!this->VTarget) return;
+
+	if (Alpha < 1.0f) {
+		C2D_ImageTint Tint;
+		C2D_AlphaImageTint(&Tint, Alpha);
+		C2D_DrawImageAt({ &this->Tex, &this->SubTex }, X, Y, 0.5f, &Tint);
+
+	} else {
+		C2D_DrawImageAt({ &this->Tex, &this->SubTex }, X, Y, 0.5f);
+	}
+}
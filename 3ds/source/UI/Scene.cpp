@@ -0,0 +1,157 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "Scene.hpp"
+#include "screenCommon.hpp"
+#include <algorithm> // std::stable_sort.
+#include <cstdint> // SIZE_MAX.
+#include <functional> // std::less.
+
+
+/*
+	Adds a node to the scene and returns its ID.
+
+	const Scene::NodeID Parent: The parent node, which the position is relative to.
+*/
+Scene::NodeID Scene::AddNode(const Scene::NodeID Parent) {
+	this->Nodes.emplace_back();
+	this->Nodes[Parent].Children.push_back(this->Nodes.size() - 1);
+
+	return this->Nodes.size() - 1;
+}
+
+
+/*
+	Sets the position of a node relative to its parent.
+
+	const Scene::NodeID Node: The node.
+	const float X: The X-Position.
+	const float Y: The Y-Position.
+*/
+void Scene::SetPos(const Scene::NodeID Node, const float X, const float Y) { this->Nodes[Node].X = X, this->Nodes[Node].Y = Y; }
+
+
+/*
+	Shows or hides a node with all of its children.
+
+	const Scene::NodeID Node: The node.
+	const bool Visible: If the node should be drawn.
+*/
+void Scene::SetVisible(const Scene::NodeID Node, const bool Visible) { this->Nodes[Node].Visible = Visible; }
+
+
+/*
+	Removes all items of a node. Its children stay.
+
+	const Scene::NodeID Node: The node.
+*/
+void Scene::Clear(const Scene::NodeID Node) { this->Nodes[Node].Items.clear(); }
+
+
+/*
+	Adds a sprite to a node.
+
+	const Scene::NodeID Node: The node.
+	const uint8_t Layer: The layer, higher layers are drawn on top.
+	C2D_SpriteSheet Sheet: The sprite sheet.
+	const size_t Idx: The sprite index of the sheet.
+	const float X: The X-Position relative to the node.
+	const float Y: The Y-Position relative to the node.
+	const float ScaleX: The X-Scale of the sprite.
+	const float ScaleY: The Y-Scale of the sprite.
+*/
+void Scene::Sprite(const Scene::NodeID Node, const uint8_t Layer, C2D_SpriteSheet Sheet, const size_t Idx, const float X, const float Y, const float ScaleX, const float ScaleY) {
+	if (!Sheet) return;
+
+	this->Nodes[Node].Items.push_back({ Layer, Sheet, Idx, X, Y, ScaleX, ScaleY });
+}
+
+
+/*
+	Adds a rectangle to a node.
+
+	const Scene::NodeID Node: The node.
+	const uint8_t Layer: The layer, higher layers are drawn on top.
+	const float X: The X-Position relative to the node.
+	const float Y: The Y-Position relative to the node.
+	const float W: The width.
+	const float H: The height.
+	const uint32_t Color: The color.
+*/
+void Scene::Rect(const Scene::NodeID Node, const uint8_t Layer, const float X, const float Y, const float W, const float H, const uint32_t Color) {
+	this->Nodes[Node].Items.push_back({ Layer, nullptr, Color, X, Y, W, H });
+}
+
+
+/*
+	Collects the items of a visible node and its children with their absolute position.
+
+	const Scene::NodeID Node: The node.
+	const float X: The X-Position of the parent.
+	const float Y: The Y-Position of the parent.
+*/
+void Scene::Collect(const Scene::NodeID Node, const float X, const float Y) {
+	const Scene::Node &N = this->Nodes[Node];
+	if (!N.Visible) return;
+
+	for (const Scene::Item &It : N.Items) {
+		this->Queue.push_back(It);
+		this->Queue.back().X += X + N.X, this->Queue.back().Y += Y + N.Y;
+	}
+
+	for (const Scene::NodeID Child : N.Children) this->Collect(Child, X + N.X, Y + N.Y);
+}
+
+
+/* Draws the scene on the current screen, sorted by layer, sprite sheet and sprite. */
+void Scene::Draw() {
+	this->Queue.clear();
+	this->Collect(Scene::Root, 0.0f, 0.0f);
+
+	std::stable_sort(this->Queue.begin(), this->Queue.end(), [](const Scene::Item &A, const Scene::Item &B) {
+		if (A.Layer != B.Layer) return A.Layer < B.Layer;
+		if (A.Sheet != B.Sheet) return std::less<C2D_SpriteSheet>()(A.Sheet, B.Sheet);
+		return A.Idx < B.Idx;
+	});
+
+	/* The image is only looked up again, once the sprite changes. */
+	C2D_SpriteSheet Sheet = nullptr;
+	size_t Count = 0, Idx = SIZE_MAX;
+	C2D_Image Image = { };
+
+	for (const Scene::Item &It : this->Queue) {
+		if (!It.Sheet) {
+			Gui::Draw_Rect(It.X, It.Y, It.W, It.H, (uint32_t)It.Idx);
+			continue;
+		}
+
+		if (It.Sheet != Sheet) Sheet = It.Sheet, Count = C2D_SpriteSheetCount(Sheet), Idx = SIZE_MAX;
+		if (It.Idx >= Count) continue;
+		if (It.Idx != Idx) Image = C2D_SpriteSheetGetImage(Sheet, It.Idx), Idx = It.Idx;
+
+		C2D_DrawImageAt(Image, It.X, It.Y, 0.5f, nullptr, It.W, It.H);
+	}
+}
@@ -0,0 +1,118 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "Common.hpp"
+#include "Transition.hpp"
+
+
+/*
+	Renders a scene into the snapshot. This does its own frame, so call it outside of GFX::BeginFrame() and GFX::EndFrame().
+	Returns false, if there's not enough VRAM for the snapshot. Draw the scene directly then.
+
+	const std::function<void()> &Render: Draws the scene with GFX::DrawTop() / GFX::DrawBottom() or GFX::ScreenDraw().
+*/
+bool Transition::Capture(const std::function<void()> &Render) {
+	this->VCaptured = false;
+	if (!this->TopTex.Init() || !this->BottomTex.Init()) return false;
+
+	C3D_FrameBegin(C3D_FRAME_SYNCDRAW);
+	C2D_TargetClear(this->TopTex.Target(), C2D_Color32(0, 0, 0, 0));
+	C2D_TargetClear(this->BottomTex.Target(), C2D_Color32(0, 0, 0, 0));
+
+	GFX::Redirect(Top, this->TopTex.Target());
+	GFX::Redirect(Bottom, this->BottomTex.Target());
+	Render();
+	GFX::Redirect(Top, nullptr);
+	GFX::Redirect(Bottom, nullptr);
+	C3D_FrameEnd(0);
+
+	this->VCaptured = true;
+	return true;
+}
+
+
+/*
+	Draws the top screen snapshot.
+
+	const float XOffs: The X-Offset, for swipes.
+	const float Alpha: The opacity (0.0f up to 1.0f), for crossfades.
+*/
+void Transition::DrawTop(const float XOffs, const float Alpha) {
+	GFX::ScreenDraw(Top);
+	this->TopTex.Draw(XOffs, 0, Alpha);
+}
+
+
+/*
+	Draws the bottom screen snapshot.
+
+	const float XOffs: The X-Offset, for swipes.
+	const float Alpha: The opacity (0.0f up to 1.0f), for crossfades.
+*/
+void Transition::DrawBottom(const float XOffs, const float Alpha) {
+	GFX::ScreenDraw(Bottom);
+	this->BottomTex.Draw(XOffs, 0, Alpha);
+}
+
+
+/*
+	Fades a scene out to black, or in from black. Any key skips it.
+	The scene is only rendered once, each step only draws the snapshot and the black rectangle.
+
+	const std::function<void()> &Render: Draws the scene.
+	const bool Out: If fading out (true) or in (false).
+*/
+void Transition::Fade(const std::function<void()> &Render, const bool Out) {
+	std::unique_ptr<Transition> Snap = std::make_unique<Transition>();
+	Snap->Capture(Render);
+
+	int16_t Alpha = (Out ? 0 : 255);
+	GFX::Invalidate();
+	Input::Flush(); // The press, that started the transition, doesn't skip it.
+
+	while(aptMainLoop()) {
+		if (GFX::BeginFrame()) {
+			if (Snap->Captured()) Snap->DrawTop();
+			else Render(); // Not enough VRAM, so render the scene each step.
+
+			GFX::ScreenDraw(Top);
+			if (Alpha > 0) Gui::Draw_Rect(0, 0, 400, 240, C2D_Color32(0, 0, 0, Alpha));
+
+			if (Snap->Captured()) Snap->DrawBottom();
+			else GFX::ScreenDraw(Bottom);
+			if (Alpha > 0) Gui::Draw_Rect(0, 0, 320, 240, C2D_Color32(0, 0, 0, Alpha));
+
+			GFX::EndFrame();
+		}
+
+		Input::Scan();
+		Input::Event E;
+		if (Input::Poll(E) && E.Down) break;
+
+		Alpha = (Out ? std::min(255, Alpha + Clock::Step(5)) : std::max(0, Alpha - Clock::Step(5)));
+		if (Alpha <= 0 || Alpha >= 255) break;
+	}
+}
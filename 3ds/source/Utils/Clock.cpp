@@ -0,0 +1,90 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "Clock.hpp"
+#include "GFX.hpp" // Animation steps change the screen.
+#include <3ds.h> // svcGetSystemTick.
+#include <cmath> // std::lerp, std::pow.
+
+#define FRAME_TIME (1.0f / 60.0f)
+#define MAX_FRAMES 15.0f // Longer gaps (e.g. the Home Menu) would otherwise skip the whole animation.
+
+static uint64_t LastTick = 0;
+static float DeltaFrames = 1.0f;
+static double TotalFrames = 0.0; // The 60 FPS frames since the start, a double so it stays exact for long sessions.
+
+
+/*
+	Advances the clock. This is called by Input::Scan(), which runs ONCE per frame in every loop.
+
+	const bool Fixed: If a fixed 60 FPS step should be used, so scripted input playback stays deterministic.
+*/
+void Clock::Tick(const bool Fixed) {
+	const uint64_t Now = svcGetSystemTick();
+
+	if (Fixed || LastTick == 0) DeltaFrames = 1.0f;
+	else {
+		DeltaFrames = ((float)(Now - LastTick) / (float)SYSCLOCK_ARM11) / FRAME_TIME;
+		if (DeltaFrames > MAX_FRAMES) DeltaFrames = MAX_FRAMES;
+	}
+
+	LastTick = Now;
+	TotalFrames += DeltaFrames;
+}
+
+
+/* The passed time of the last frame in 60 FPS frames. */
+float Clock::Frames() { return DeltaFrames; }
+
+
+/* The passed time since the start in 60 FPS frames. It only advances with Clock::Tick(), so scripted playback stays deterministic. */
+double Clock::Now() { return TotalFrames; }
+
+
+/*
+	Frame rate independent version of std::lerp(A, B, Rate) called once per 60 FPS frame.
+
+	const float A: The current value.
+	const float B: The target value.
+	const float Rate: The rate for one 60 FPS frame, like the one passed to std::lerp before.
+*/
+float Clock::Lerp(const float A, const float B, const float Rate) {
+	GFX::Invalidate();
+	if (DeltaFrames == 1.0f) return std::lerp(A, B, Rate);
+	return std::lerp(A, B, 1.0f - std::pow(1.0f - Rate, DeltaFrames));
+}
+
+
+/*
+	Scales a linear per frame step, like a fade of 5 alpha per frame, to the passed time.
+
+	const int PerFrame: The step for one 60 FPS frame.
+*/
+int Clock::Step(const int PerFrame) {
+	GFX::Invalidate();
+	const int Res = std::lround(PerFrame * DeltaFrames);
+	return (Res > 0 ? Res : 1);
+}
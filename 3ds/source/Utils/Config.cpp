@@ -88,6 +88,7 @@ void Config::Load() {
 	}
 
 	if (!this->CFG.is_discarded()) {
+		this->BoardGrid(this->Get<nlohmann::json::number_integer_t>("BoardGrid", this->BoardGrid()));
 		this->CardSet(this->Get<std::string>("Cardset", this->CardSet()));
 		this->CharSet(this->Get<std::string>("Charset", this->CharSet()));
 		this->DoAnimation(this->Get<bool>("DoAnimation", this->DoAnimation()));
@@ -104,6 +105,7 @@ void Config::Load() {
 /* Initializes the Configuration file properly as a JSON. */
 void Config::Initialize() {
 	const nlohmann::json OBJ = {
+		{ "BoardGrid", this->BoardGrid() }, // Board Grid.
 		{ "Cardset", this->CardSet() }, // Cardset.
 		{ "Charset", this->CharSet() }, // Character Set.
 		{ "DoAnimation", this->DoAnimation() }, // Animation.
@@ -129,6 +131,7 @@ void Config::Initialize() {
 /* SAV changes to the Configuration, if changes made. */
 void Config::Sav() {
 	if (this->ChangesMade) {
+		this->Set<nlohmann::json::number_integer_t>("BoardGrid", this->BoardGrid()); // Board Grid.
 		this->Set<std::string>("Cardset", this->CardSet()); // Cardset.
 		this->Set<std::string>("Charset", this->CharSet()); // Cardset.
 		this->Set<bool>("DoAnimation", this->DoAnimation()); // Animation.
@@ -0,0 +1,120 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "Gesture.hpp"
+#include "Clock.hpp" // Frame based velocity.
+#include <cmath> // std::fabs.
+
+#define SLOP 6.0f // Pixels the finger can move, before a touch becomes a drag.
+#define SWIPE_DISTANCE 80.0f // Pixels a drag needs to be a swipe.
+#define FLICK_SPEED 6.0f // Pixels per frame on release, that make even a short drag a flick.
+#define LONG_PRESS 30.0f // Frames a touch has to be held still.
+#define SMOOTHING 0.5f // How much the last movement counts into the velocity.
+
+
+/*
+	Advances the recognizer by one frame.
+	Returns the gesture of this frame, or Type::None.
+
+	const uint32_t Held: The Input::Held() variable.
+	const touchPosition &T: The current touch position.
+*/
+Gesture::Type Gesture::Update(const uint32_t Held, const touchPosition &T) {
+	if (!(Held & KEY_TOUCH)) { // The release frame has no valid position, so the last one is used.
+		if (this->CurState == State::Idle) return Type::None;
+
+		const Type Res = this->Released();
+		this->CurState = State::Idle;
+		return Res;
+	}
+
+	switch(this->CurState) {
+		case State::Idle:
+			this->SX = this->X = T.px, this->SY = this->Y = T.py;
+			this->VX = 0.0f, this->HeldFrames = 0.0f;
+			this->CurState = State::Pressed;
+			return Type::Press;
+
+		case State::Held:
+		case State::Ignored:
+			return Type::None;
+
+		case State::Pressed:
+		case State::Dragging:
+			break;
+	}
+
+	/* Smooth the velocity, a single frame of a touch screen jitters too much. */
+	const float Frames = Clock::Frames();
+	if (Frames > 0.0f) this->VX = (this->VX * (1.0f - SMOOTHING)) + (((T.px - this->X) / Frames) * SMOOTHING);
+	this->X = T.px, this->Y = T.py;
+
+	if (this->CurState == State::Dragging) return Type::Drag;
+
+	if (std::fabs(this->DX()) > SLOP || std::fabs(this->DY()) > SLOP) {
+		this->CurState = State::Dragging;
+		return Type::Drag;
+	}
+
+	this->HeldFrames += Frames;
+	if (this->HeldFrames >= LONG_PRESS) {
+		this->CurState = State::Held;
+		return Type::LongPress;
+	}
+
+	return Type::None;
+}
+
+
+/*
+	Ignores the current touch until it's released, like if it got used as any key already.
+	That works as well, if the touch started while the recognizer didn't get updated.
+*/
+void Gesture::Cancel() { this->CurState = State::Ignored; }
+
+
+/*
+	Returns the gesture of the released touch.
+	Swipes and flicks are horizontal only, like all page switches.
+*/
+Gesture::Type Gesture::Released() {
+	switch(this->CurState) {
+		case State::Pressed:
+			return Type::Tap;
+
+		case State::Dragging:
+			if (std::fabs(this->VX) >= FLICK_SPEED && ((this->VX < 0.0f) == (this->DX() < 0.0f))) return Type::Flick;
+			if (std::fabs(this->DX()) >= SWIPE_DISTANCE) return Type::Swipe;
+			return Type::Release;
+
+		case State::Idle:
+		case State::Held:
+		case State::Ignored:
+			break;
+	}
+
+	return Type::None;
+}
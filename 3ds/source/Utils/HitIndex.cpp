@@ -0,0 +1,124 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "HitIndex.hpp"
+#include <algorithm> // std::clamp.
+
+#define CELL_SIZE 16 // The size of a grid cell in pixels.
+
+
+/*
+	Builds the grid from the callback positions.
+
+	const std::vector<FuncCallback> &Callbacks: The callbacks. Up to 256 are supported.
+	const uint16_t Width: The width of the grid. The default covers the top screen, so it works on both screens.
+	const uint16_t Height: The height of the grid.
+*/
+HitIndex::HitIndex(const std::vector<FuncCallback> &Callbacks, const uint16_t Width, const uint16_t Height) : Callbacks(Callbacks) {
+	this->Cols = (Width + CELL_SIZE - 1) / CELL_SIZE, this->Rows = (Height + CELL_SIZE - 1) / CELL_SIZE;
+	std::vector<std::vector<uint8_t>> Cells(this->Cols * this->Rows);
+
+	/* The edges are part of a callback, so a callback covers the cells from its start up to its end position. */
+	for (size_t Idx = 0; Idx < Callbacks.size() && Idx < 256; Idx++) {
+		const size_t First = this->Cell(Callbacks[Idx].X, Callbacks[Idx].Y), Last = this->Cell(Callbacks[Idx].X + Callbacks[Idx].W, Callbacks[Idx].Y + Callbacks[Idx].H);
+
+		for (size_t Row = First / this->Cols; Row <= Last / this->Cols; Row++) {
+			for (size_t Col = First % this->Cols; Col <= Last % this->Cols; Col++) Cells[Row * this->Cols + Col].push_back(Idx);
+		}
+	}
+
+	/* Pack the cells into one list. */
+	this->Start.reserve(Cells.size() + 1);
+
+	for (const std::vector<uint8_t> &Cell : Cells) {
+		this->Start.push_back(this->Entries.size());
+		this->Entries.insert(this->Entries.end(), Cell.begin(), Cell.end());
+	}
+
+	this->Start.push_back(this->Entries.size());
+}
+
+
+/*
+	The cell of a position. Positions outside of the screen go to the nearest cell.
+
+	const float X: The X-Position.
+	const float Y: The Y-Position.
+*/
+size_t HitIndex::Cell(const float X, const float Y) const {
+	const int Col = std::clamp((int)X / CELL_SIZE, 0, this->Cols - 1), Row = std::clamp((int)Y / CELL_SIZE, 0, this->Rows - 1);
+	return Row * this->Cols + Col;
+}
+
+
+/*
+	Returns the index of the first callback at a position, or -1 if there is none.
+
+	const float X: The X-Position.
+	const float Y: The Y-Position.
+*/
+int HitIndex::Find(const float X, const float Y) const {
+	const size_t Cell = this->Cell(X, Y);
+
+	for (size_t Entry = this->Start[Cell]; Entry < this->Start[Cell + 1]; Entry++) {
+		const FuncCallback &CBack = this->Callbacks[this->Entries[Entry]];
+		if (X >= CBack.X && X <= CBack.X + CBack.W && Y >= CBack.Y && Y <= CBack.Y + CBack.H) return this->Entries[Entry];
+	}
+
+	return -1;
+}
+
+
+/*
+	Returns, if a callback got clicked with the pointer.. and if so, execute optionally it's function.
+	This is the same as calling Pointer::Clicked() on each callback, until one got clicked.
+
+	const bool CallFunc: If the function should be called if clicked or not.
+*/
+bool HitIndex::Clicked(const bool CallFunc) const {
+	const int Idx = this->Find(Pointer::HitX(), Pointer::HitY());
+	if (Idx < 0) return false;
+
+	if (!Pointer::Show) Pointer::Show = true; // Show pointer, if clicked.
+	if (CallFunc) this->Callbacks[Idx].Func();
+	return true;
+}
+
+
+/*
+	Returns, if a callback got touched.. and if so, execute optionally it's function.
+	This is the same as calling Touched() on each callback, until one got touched.
+
+	const touchPosition &T: The touchPosition variable.
+	const bool CallFunc: If the function should be called if touched or not.
+*/
+bool HitIndex::Touched(const touchPosition &T, const bool CallFunc) const {
+	const int Idx = this->Find(T.px, T.py);
+	if (Idx < 0) return false;
+
+	if (CallFunc) this->Callbacks[Idx].Func();
+	return true;
+}
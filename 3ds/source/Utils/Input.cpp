@@ -0,0 +1,250 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+/*
+	Input Script format notes:
+
+	Each line sets the held keys (and optionally the touch position) from the given frame on,
+	until the next line changes them. Lines starting with '#' are ignored.
+
+		<frame> <held keys> [<touch x> <touch y>]
+
+	The held keys are the libctru KEY_* bits, either as decimal or hexadecimal with '0x'.
+	If a touch position is given, KEY_TOUCH is added to the held keys automatically.
+	Down and repeat are derived from the held keys, with the same repeat parameters the app sets (25, 5).
+
+	Example: Tap the first card at frame 300 and press A at frame 400.
+		300 0x0 38 26
+		302 0x0
+		400 0x1
+		402 0x0
+*/
+
+#include "Clock.hpp"
+#include "GFX.hpp" // Input changes the screen.
+#include "Input.hpp"
+#include <atomic> // The drawing reads the frame.
+#include <cstdio>
+#include <vector>
+
+#define REPEAT_DELAY    25 // hidSetRepeatParameters(25, 5).
+#define REPEAT_INTERVAL  5
+#define MAX_SAMPLES    256 // The latency samples to store.
+#define MAX_EVENTS      16 // The queued presses, older ones get replaced.
+
+struct ScriptEntry { uint32_t Frame; uint32_t Held; uint16_t X; uint16_t Y; };
+struct LatencySample { const char *Tag; uint32_t Frames; };
+
+static std::vector<ScriptEntry> Script;
+static size_t ScriptPos = 0;
+static bool PlaybackActive = false, Measure = false; // Measuring only happens, if a script got loaded.
+
+static std::atomic<uint32_t> Frame = 0; // The scanned frames, starting with 1. 0 is no frame.
+static uint32_t KDown = 0, KHeld = 0, KRepeat = 0, PrevHeld = 0, HeldFrames = 0;
+static uint32_t LastHeld = 0; // For the screen invalidation.
+static touchPosition Touch = { 0, 0 };
+
+/* The queued presses, as a ring buffer. */
+static Input::Event Events[MAX_EVENTS];
+static size_t EventStart = 0, EventCount = 0;
+static bool KeepEvents = false; // If the presses stay queued across frames, see Input::Queue().
+
+/* Latency related. */
+static LatencySample Samples[MAX_SAMPLES];
+static size_t SampleCount = 0;
+
+
+/* Scans the input of the current frame. Call this ONCE per frame instead of hidScanInput(). */
+void Input::Scan() {
+	Frame++;
+
+	if (PlaybackActive) {
+		/* Apply all script entries up to the current frame. */
+		while (ScriptPos < Script.size() && Script[ScriptPos].Frame <= Frame) {
+			const uint32_t OldHeld = KHeld;
+
+			KHeld = Script[ScriptPos].Held;
+			Touch.px = Script[ScriptPos].X, Touch.py = Script[ScriptPos].Y;
+			if (OldHeld != KHeld) HeldFrames = 0;
+			ScriptPos++;
+		}
+
+		KDown = KHeld & ~PrevHeld;
+		PrevHeld = KHeld;
+
+		/* Emulate the key repeat. */
+		if (KHeld && !KDown) HeldFrames++;
+		KRepeat = KDown | ((HeldFrames >= REPEAT_DELAY && (HeldFrames - REPEAT_DELAY) % REPEAT_INTERVAL == 0) ? KHeld : 0);
+
+		if (ScriptPos >= Script.size() && !KHeld) PlaybackActive = false; // Script is over, return to the hardware.
+
+	} else {
+		hidScanInput();
+		KDown = hidKeysDown();
+		KHeld = hidKeysHeld();
+		KRepeat = hidKeysDownRepeat();
+		hidTouchRead(&Touch);
+	}
+
+	/* Queue the presses of this frame. If the queue is full, the oldest press gets replaced. */
+	if (!KeepEvents) EventCount = 0; // The presses of the previous frames got handled through Down() already.
+	if (KDown || KRepeat) {
+		if (EventCount == MAX_EVENTS) EventStart = (EventStart + 1) % MAX_EVENTS, EventCount--;
+		Events[(EventStart + EventCount++) % MAX_EVENTS] = { KDown, KRepeat, Touch, Frame.load(), svcGetSystemTick() };
+	}
+
+	Clock::Tick(PlaybackActive); // Playback uses fixed frame steps to stay deterministic.
+	if (KDown || KHeld || KHeld != LastHeld) GFX::Invalidate(); // Presses, held keys and releases.
+	LastHeld = KHeld;
+}
+
+
+uint32_t Input::Down() { return KDown; }
+uint32_t Input::Held() { return KHeld; }
+uint32_t Input::Repeat() { return KRepeat; }
+uint32_t Input::ScanFrame() { return Frame; }
+void Input::TouchRead(touchPosition *T) { *T = Touch; }
+
+
+/*
+	Takes the oldest queued press. Presses, which are older than MaxAge frames are dropped, so a stale press
+	doesn't act on something the player can't expect anymore. The age is counted in frames, so playbacks stay deterministic.
+
+	Event &E: The press to fill.
+	const uint32_t MaxAge: The maximal age in frames.
+
+	Returns false, if no press is queued.
+*/
+bool Input::Poll(Input::Event &E, const uint32_t MaxAge) {
+	while (EventCount > 0) {
+		E = Events[EventStart];
+		EventStart = (EventStart + 1) % MAX_EVENTS, EventCount--;
+
+		if (Frame - E.Frame <= MaxAge) return true;
+	}
+
+	return false;
+}
+
+
+/* Drops all queued presses, like when a new screen starts. */
+void Input::Flush() { EventCount = 0; }
+
+
+/*
+	Sets, if the presses stay queued across frames until they get polled.
+	Only a loop that takes all of its presses through Poll() should set this, and reset it once it's done.
+
+	const bool Keep: If the presses should stay queued.
+*/
+void Input::Queue(const bool Keep) { KeepEvents = Keep; }
+
+
+/* The circle pad is not part of the scripts, so it stays centered during a playback. */
+void Input::CircleRead(circlePosition *C) {
+	if (PlaybackActive) C->dx = 0, C->dy = 0;
+	else hidCircleRead(C);
+}
+
+
+/*
+	Loads an input script and starts the playback with the next frame.
+
+	const std::string &File: The path to the script.
+
+	Returns true, if at least one entry got loaded.
+*/
+bool Input::LoadScript(const std::string &File) {
+	FILE *In = fopen(File.c_str(), "r");
+	if (!In) return false;
+
+	Script.clear();
+	char Line[128];
+
+	while (fgets(Line, sizeof(Line), In)) {
+		if (Line[0] == '#') continue;
+
+		unsigned long EFrame = 0;
+		long long EHeld = 0; // %lli, so both decimal and '0x' work.
+		unsigned int X = 0, Y = 0;
+		const int Res = sscanf(Line, "%lu %lli %u %u", &EFrame, &EHeld, &X, &Y);
+
+		if (Res >= 2) {
+			if (Res == 4) EHeld |= KEY_TOUCH;
+			Script.push_back({ (uint32_t)EFrame + Frame, (uint32_t)EHeld, (uint16_t)X, (uint16_t)Y });
+		}
+	}
+
+	fclose(In);
+
+	ScriptPos = 0, HeldFrames = 0, PrevHeld = KHeld;
+	PlaybackActive = !Script.empty();
+	if (PlaybackActive) {
+		Measure = true;
+		GFX::ResetFrameStats(); // Only the frames of the playback count.
+	}
+
+	return PlaybackActive;
+}
+
+
+bool Input::Playback() { return PlaybackActive; }
+
+
+/*
+	Records the latency of a press, once the frame with its change got presented.
+	This is called by the drawing and not by the logic, so it counts until the change is really on the screen.
+
+	const char *Tag: What became visible, e.g. "Flip" or "Page". Must be a string literal.
+	const uint32_t PressFrame: The frame the press got scanned on, see Input::ScanFrame().
+*/
+void Input::Presented(const char *Tag, const uint32_t PressFrame) {
+	if (!Measure || !Tag || PressFrame == 0) return;
+
+	if (SampleCount < MAX_SAMPLES) Samples[SampleCount++] = { Tag, Frame - PressFrame + 1 }; // It shows up with the next refresh.
+}
+
+
+/*
+	Writes the measured latencies, one sample per line, if any exist. The frame statistics come first as a comment.
+
+	const std::string &File: The path to the report.
+*/
+void Input::WriteReport(const std::string &File) {
+	if (SampleCount == 0) return;
+
+	FILE *Out = fopen(File.c_str(), "w");
+	if (!Out) return;
+
+	const GFX::FrameStats F = GFX::GetFrameStats();
+	fprintf(Out, "# drawn %lu, skipped %lu, idle %lu, frame time avg %.2f ms, max %.2f ms\n",
+		(unsigned long)F.Drawn, (unsigned long)F.Skipped, (unsigned long)F.Idle, F.AvgMs, F.MaxMs);
+
+	fprintf(Out, "# tag frames\n");
+	for (size_t Idx = 0; Idx < SampleCount; Idx++) fprintf(Out, "%s %lu\n", Samples[Idx].Tag, (unsigned long)Samples[Idx].Frames);
+
+	fclose(Out);
+}
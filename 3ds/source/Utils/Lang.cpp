@@ -31,18 +31,36 @@
 #include <unistd.h>
 
 
-static nlohmann::json AppJSON;
+static std::string Strings[(size_t)Lang::Str::Count]; // The strings of the current language, indexed by their ID.
+static size_t PrewarmPos = 0; // The next string to cache.
 
 
 /*
-	Gets a translated string from the JSON.
+	Gets a translated string.
 
-	const std::string &Key: The string to get from the translation.
+	const Lang::Str ID: The ID of the string to get.
 */
-std::string Lang::Get(const std::string &Key) {
-	if (!AppJSON.contains(Key)) return "";
+const std::string &Lang::Get(const Lang::Str ID) { return Strings[(size_t)ID]; }
 
-	return AppJSON.at(Key).get_ref<const std::string &>();
+
+/*
+	Fills the string table from a translation JSON.
+
+	FILE *In: The file of the JSON.
+	const bool Fill: If only the strings missing so far should be set.
+*/
+static void ReadStrings(FILE *In, const bool Fill) {
+	if (!In) return;
+
+	const nlohmann::json JSON = nlohmann::json::parse(In, nullptr, false);
+	fclose(In);
+	if (!JSON.is_object()) return;
+
+	for (size_t Idx = 0; Idx < (size_t)Lang::Str::Count; Idx++) {
+		if (Fill && Strings[Idx] != "") continue;
+
+		if (JSON.contains(Lang::Keys[Idx]) && JSON[Lang::Keys[Idx]].is_string()) Strings[Idx] = JSON[Lang::Keys[Idx]].get_ref<const std::string &>();
+	}
 }
 
 
@@ -60,22 +78,46 @@ void Lang::Load() {
 		}
 	}
 
+	for (size_t Idx = 0; Idx < (size_t)Lang::Str::Count; Idx++) Strings[Idx].clear();
+
 	if (Good) {
 		if (access(("romfs:/lang/" + _3DZwei::CFG->Lang() + "/app.json").c_str(), F_OK) == 0) { // Ensure access is ok.
 			In = fopen(("romfs:/lang/" + _3DZwei::CFG->Lang() + "/app.json").c_str(), "r");
-			if (In)	AppJSON = nlohmann::json::parse(In, nullptr, false);
-			fclose(In);
+			ReadStrings(In, false);
 
 		} else {
 			Good = false;
 		}
 	}
 
-	if (!Good) {
-		/* Load English. */
+	if (!Good) _3DZwei::CFG->Lang("en"); // Set back to english.
+
+	/* Load english, if it failed, and for the strings which aren't translated (yet). */
+	if (!Good || _3DZwei::CFG->Lang() != "en") {
 		In = fopen("romfs:/lang/en/app.json", "r");
-		if (In)	AppJSON = nlohmann::json::parse(In, nullptr, false);
-		fclose(In);
-		_3DZwei::CFG->Lang("en"); // Set back to english too.
+		ReadStrings(In, true);
 	}
+
+	GFX::ClearTextCache(); // The cached texts are from the old language.
+	PrewarmPos = 0;
+}
+
+
+/*
+	Caches the strings of the language for drawing, a few per call, so the first frame of an overlay doesn't have to
+	look up the glyphs. Large glyph sets like Japanese take the longest there. Call this on frames with time to spare,
+	like during the splash. The text cache isn't thread-safe, so this runs in the main loop and not on a thread.
+	Returns true, once all strings are cached or the cache is full.
+
+	const size_t Amount: The strings to cache in this call.
+*/
+bool Lang::Prewarm(const size_t Amount) {
+	for (size_t Idx = 0; Idx < Amount && PrewarmPos < (size_t)Lang::Str::Count; Idx++, PrewarmPos++) {
+		const std::string &Text = Strings[PrewarmPos];
+		if (Text.find('%') != std::string::npos) continue; // Format strings are only drawn formatted.
+
+		if (!GFX::CacheText(Text)) PrewarmPos = (size_t)Lang::Str::Count; // Full, keep the rest free for the screens.
+	}
+
+	return PrewarmPos >= (size_t)Lang::Str::Count;
 }
\ No newline at end of file
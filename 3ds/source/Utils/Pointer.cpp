@@ -43,7 +43,7 @@ bool Pointer::OnTop = false, Pointer::Show = true;
 /*
 	Handles the Pointer Scrolling.
 
-	const uint32_t Held: The key held input variable, also known as hidKeysHeld() on 3DS.
+	const uint32_t Held: The key held input variable, also known as Input::Held() on 3DS.
 	const bool InGame: If in game (true) or not (false).
 */
 void Pointer::ScrollHandling(const uint32_t Held, const bool InGame) {
@@ -79,9 +79,11 @@ void Pointer::ScrollHandling(const uint32_t Held, const bool InGame) {
 		}
 	}
 
+	const float OldX = Pointer::X, OldY = Pointer::Y;
+
 	/* Analog movement with the circle pad. */
 	circlePosition cPos;
-	hidCircleRead(&cPos);
+	Input::CircleRead(&cPos);
 	if(cPos.dx > 15 || cPos.dx < -15) Pointer::X += PTR_SPEED * 2 * cPos.dx / 165.0f;
 	if(cPos.dy > 15 || cPos.dy < -15) Pointer::Y += PTR_SPEED * 2 * -cPos.dy / 165.0f;
 
@@ -90,16 +92,17 @@ void Pointer::ScrollHandling(const uint32_t Held, const bool InGame) {
 	if (Pointer::X > (Pointer::OnTop ? 400 : 320) - PTR_X_SIZE) Pointer::X = (Pointer::OnTop ? 400 : 320) - PTR_X_SIZE;
 	if (Pointer::Y < -Y_DIST) Pointer::Y = -Y_DIST;
 	if (Pointer::Y > (240 - PTR_Y_SIZE)) Pointer::Y = (240 - PTR_Y_SIZE);
+	if (Pointer::X != OldX || Pointer::Y != OldY) GFX::Invalidate();
 }
 
 
 /*
 	Returns, of a specific Callback Position was clicked.. and if so, execute optionally it's function.
 
-	const FuncCallback CBack: The Callback which to check.
+	const FuncCallback &CBack: The Callback which to check.
 	const bool CallFunc: If the function should be called if clicked or not.
 */
-bool Pointer::Clicked(const FuncCallback CBack, const bool CallFunc) {
+bool Pointer::Clicked(const FuncCallback &CBack, const bool CallFunc) {
 	if (((Pointer::X + X_DIST) >= CBack.X && (Pointer::X + X_DIST) <= CBack.X + CBack.W)
 		&& ((Pointer::Y + Y_DIST) >= CBack.Y && (Pointer::Y + Y_DIST) <= CBack.Y + CBack.H)) {
 			if (!Pointer::Show) Pointer::Show = true; // Show pointer, if clicked.
@@ -114,11 +117,11 @@ bool Pointer::Clicked(const FuncCallback CBack, const bool CallFunc) {
 /*
 	Returns, of a specific Callback Position was touched.. and if so, execute optionally it's function.
 
-	const FuncCallback CBack: The Callback which to check.
-	touchPosition T: The touchPosition variable.
+	const FuncCallback &CBack: The Callback which to check.
+	const touchPosition &T: The touchPosition variable.
 	const bool CallFunc: If the function should be called if clicked or not.
 */
-bool Touched(const FuncCallback CBack, touchPosition T, const bool CallFunc) {
+bool Touched(const FuncCallback &CBack, const touchPosition &T, const bool CallFunc) {
 	if (T.px >= CBack.X && T.px <= (CBack.X + CBack.W) && T.py >= CBack.Y && T.py <= (CBack.Y + CBack.H)) {
 		if (CallFunc) CBack.Func();
 		return true;
@@ -128,10 +131,16 @@ bool Touched(const FuncCallback CBack, touchPosition T, const bool CallFunc) {
 }
 
 
-/* Draw the Pointer. */
-void Pointer::Draw() { if (Pointer::Show) Gui::DrawSprite(GFX::Sprites, sprites_pointer_idx, Pointer::X, Pointer::Y); }
+/* The position, which the pointer clicks at. */
+float Pointer::HitX() { return Pointer::X + X_DIST; }
+float Pointer::HitY() { return Pointer::Y + Y_DIST; }
+
+
+/* Draw the Pointer, or a pointer at a position of a frame snapshot. */
+void Pointer::Draw() { if (Pointer::Show) Pointer::Draw(Pointer::X, Pointer::Y); }
+void Pointer::Draw(const float X, const float Y) { Gui::DrawSprite(GFX::Sprites, sprites_pointer_idx, X, Y); }
 
 
 /* Set Pointer Position from two float's, or the Pointer Struct. */
-void Pointer::SetPos(const FuncCallback CBack) { Pointer::X = CBack.X, Pointer::Y = CBack.Y; }
-void Pointer::SetPos(const float X, const float Y) { Pointer::X = X, Pointer::Y = Y; }
\ No newline at end of file
+void Pointer::SetPos(const FuncCallback &CBack) { Pointer::X = CBack.X, Pointer::Y = CBack.Y, GFX::Invalidate(); }
+void Pointer::SetPos(const float X, const float Y) { Pointer::X = X, Pointer::Y = Y, GFX::Invalidate(); }
\ No newline at end of file
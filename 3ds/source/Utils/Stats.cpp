@@ -0,0 +1,144 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+#include "JSON.hpp"
+#include "Stats.hpp"
+#include <algorithm> // std::min.
+#include <unistd.h>
+
+#define STATS_PATH "sdmc:/3ds/ut-games/3DZwei/Stats.json"
+
+#define TURN_BINS       32 // Turns to finish: 32 bins..
+#define TURN_BIN_WIDTH   5 // ..of 5 turns each, the last bin also collects everything above.
+#define PAIR_BINS       33 // Misses per pair count: 33 bins..
+#define PAIR_BIN_WIDTH  10 // ..of 10 pairs each, which covers the 323 cards of a full set.
+#define STARTERS         5 // One entry per GameSettings::RoundStarter.
+
+static uint32_t Rounds = 0;
+static uint32_t TurnHist[TURN_BINS] = { 0 };
+static uint32_t MissRounds[PAIR_BINS] = { 0 }, MissSum[PAIR_BINS] = { 0 };
+static uint32_t StarterRounds[STARTERS] = { 0 }, StarterWins[STARTERS] = { 0 }, StarterTies[STARTERS] = { 0 };
+static bool ChangesMade = false;
+
+
+/*
+	Read a JSON array into a fixed-size histogram.
+
+	const nlohmann::json &JSON: The statistics object.
+	const char *Key: The key of the array.
+	uint32_t *Out: The histogram to fill.
+	const size_t Size: The amount of bins of the histogram.
+*/
+static void ReadBins(const nlohmann::json &JSON, const char *Key, uint32_t *Out, const size_t Size) {
+	if (!JSON.contains(Key) || !JSON[Key].is_array()) return;
+
+	for (size_t Idx = 0; Idx < Size && Idx < JSON[Key].size(); Idx++) {
+		if (JSON[Key][Idx].is_number_unsigned()) Out[Idx] = JSON[Key][Idx].get<uint32_t>();
+	}
+}
+
+
+/* Loads the statistics, if they exist. */
+void Stats::Load() {
+	if (access(STATS_PATH, F_OK) != 0) return;
+
+	FILE *In = fopen(STATS_PATH, "r");
+	if (!In) return;
+
+	const nlohmann::json JSON = nlohmann::json::parse(In, nullptr, false);
+	fclose(In);
+
+	if (JSON.is_discarded() || !JSON.is_object()) return;
+
+	if (JSON.contains("Rounds") && JSON["Rounds"].is_number_unsigned()) Rounds = JSON["Rounds"].get<uint32_t>();
+	ReadBins(JSON, "TurnsToFinish", TurnHist, TURN_BINS);
+	ReadBins(JSON, "MissRounds", MissRounds, PAIR_BINS);
+	ReadBins(JSON, "MissSum", MissSum, PAIR_BINS);
+	ReadBins(JSON, "StarterRounds", StarterRounds, STARTERS);
+	ReadBins(JSON, "StarterWins", StarterWins, STARTERS);
+	ReadBins(JSON, "StarterTies", StarterTies, STARTERS);
+}
+
+
+/* SAV the statistics, if a round has been added since the last save. */
+void Stats::Sav() {
+	if (!ChangesMade) return;
+
+	const nlohmann::json OBJ = {
+		{ "Rounds", Rounds },
+		{ "TurnsToFinish", TurnHist },
+		{ "MissRounds", MissRounds },
+		{ "MissSum", MissSum },
+		{ "StarterRounds", StarterRounds },
+		{ "StarterWins", StarterWins },
+		{ "StarterTies", StarterTies }
+	};
+
+	FILE *Out = fopen(STATS_PATH, "w");
+
+	if (Out) {
+		const std::string Dump = OBJ.dump(1, '\t');
+		fwrite(Dump.c_str(), 1, Dump.size(), Out);
+		fclose(Out);
+		ChangesMade = false;
+	}
+}
+
+
+/*
+	Fold a finished round into the histograms.
+
+	const GameSettings::GameParams &Params: The parameters of the game.
+	const size_t Pairs: The amount of pairs of the round.
+	const size_t Turns: The amount of turns it took to finish the round.
+	const size_t Misses: The amount of turns without a pair.
+	const StackMem::Players Starter: The player who started the round.
+	const StackMem::GameState Result: The result of the round.
+*/
+void Stats::AddRound(const GameSettings::GameParams &Params, const size_t Pairs, const size_t Turns, const size_t Misses, const StackMem::Players Starter, const StackMem::GameState Result) {
+	if (Pairs == 0) return;
+
+	Rounds++;
+	TurnHist[std::min<size_t>(Turns / TURN_BIN_WIDTH, TURN_BINS - 1)]++;
+
+	const size_t PairBin = std::min<size_t>((Pairs - 1) / PAIR_BIN_WIDTH, PAIR_BINS - 1);
+	MissRounds[PairBin]++;
+	MissSum[PairBin] += Misses;
+
+	/* The first player advantage only makes sense with two players. */
+	if (Params.GameMode == GameSettings::GameModes::Versus) {
+		const uint8_t Idx = (uint8_t)Params.Starter;
+
+		if (Idx < STARTERS) {
+			StarterRounds[Idx]++;
+
+			if (Result == StackMem::GameState::Tie) StarterTies[Idx]++;
+			else if ((Result == StackMem::GameState::Player1) == (Starter == StackMem::Players::Player1)) StarterWins[Idx]++;
+		}
+	}
+
+	ChangesMade = true;
+}
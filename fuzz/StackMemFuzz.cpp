@@ -0,0 +1,364 @@
+/*
+*   This file is part of 3DZwei
+*   Copyright (C) 2020-2023 Universal-Team
+*
+*   This program is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   This program is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+*       * Requiring preservation of specified reasonable legal notices or
+*         author attributions in that material or in the Appropriate Legal
+*         Notices displayed by works containing it.
+*       * Prohibiting misrepresentation of the origin of that material,
+*         or requiring that modified versions of such material be marked in
+*         reasonable ways as different from the original version.
+*/
+
+/*
+	Drives StackMem with random API sequences and checks it after every call.
+	Next to CheckIntegrity(), the harness keeps its own count of the pairs and shown cards, and makes sure a refused change
+	leaves the whole state as it was.
+
+	Each byte of an input picks an operation and the following bytes are its parameters, so the same input always runs
+	the same sequence. Built as a libFuzzer target with -DLIBFUZZER, otherwise as a seeded random driver:
+
+		./stackmem-fuzz [Runs] [Seed]
+*/
+
+#include "StackMem.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#define MAX_PAIRS 24 // The card sets have up to 323 front covers, but more pairs only make the runs slower.
+
+
+/* Reads the parameters from an input. It returns 0 once the input is used up. */
+class Reader {
+public:
+	Reader(const uint8_t *Data, const size_t Size) : Data(Data), Size(Size) { };
+
+	bool Empty() const { return this->Pos >= this->Size; };
+	uint8_t Byte() { return (this->Pos < this->Size ? this->Data[this->Pos++] : 0); };
+	bool Bool() { return this->Byte() & 1; };
+private:
+	const uint8_t *Data = nullptr;
+	size_t Size = 0, Pos = 0;
+};
+
+
+/*
+	Everything, that can be read of a game through its public functions.
+	Two states are equal, if every field is, so a refused change has to leave all of them as they were.
+*/
+struct State {
+	struct Card { int Type; bool Shown; bool Collected; bool operator==(const Card &Other) const = default; };
+
+	std::vector<Card> Cards;
+	size_t Pairs, PlayerPairs[2];
+	int TurnCards[2];
+	StackMem::TurnState Turn;
+	StackMem::Players Player;
+	bool AIUsed;
+	StackMem::AIMethod Method;
+
+	bool operator==(const State &Other) const = default;
+};
+
+
+/*
+	The bookkeeping of the harness. It's updated from what each operation should do, not from what StackMem did,
+	so it catches mistakes CheckIntegrity() can't see, as the setters already refuse everything it fails on.
+
+	size_t Pairs: The pairs each player should have. Only a DoCheck of a new matching turn adds one.
+	size_t Shown: The amount of shown cards.
+	bool Checked: If DoCheck already handled the current turn.
+*/
+struct Model {
+	size_t Pairs[2] = { 0, 0 };
+	size_t Shown = 0;
+	bool Checked = false;
+};
+
+
+/*
+	Reads the state of a game.
+
+	const StackMem &Game: The game.
+*/
+static State Read(const StackMem &Game) {
+	State S = { };
+	S.Pairs = Game.GetPairs();
+
+	for (size_t Idx = 0; Idx < Game.GetPairs() * 2; Idx++) {
+		S.Cards.push_back({ Game.GetCardType(Idx), Game.IsCardShown(Idx), Game.IsCardCollected(Idx) });
+	}
+
+	S.PlayerPairs[0] = Game.GetPlayerPairs(StackMem::Players::Player1);
+	S.PlayerPairs[1] = Game.GetPlayerPairs(StackMem::Players::Player2);
+	S.TurnCards[0] = Game.GetTurnCard(0), S.TurnCards[1] = Game.GetTurnCard(1);
+	S.Turn = Game.GetState(), S.Player = Game.GetCurrentPlayer();
+	S.AIUsed = Game.AIEnabled(), S.Method = Game.GetMethod();
+	return S;
+}
+
+
+/*
+	Aborts with the failed operation.
+
+	const size_t Step: The index of the operation.
+	const char *Op: The name of the operation.
+	const char *What: What is wrong.
+*/
+[[noreturn]] static void Fail(const size_t Step, const char *Op, const char *What) {
+	fprintf(stderr, "StackMem failed after step %zu (%s): %s.\n", Step, Op, What);
+	abort();
+}
+
+
+/*
+	Aborts with the failed operation, if the game isn't consistent anymore or doesn't match the model.
+
+	const StackMem &Game: The game.
+	const Model &M: The model of the harness.
+	const size_t Step: The index of the operation.
+	const char *Op: The name of the operation.
+*/
+static void Check(const StackMem &Game, const Model &M, const size_t Step, const char *Op) {
+	if (!Game.CheckIntegrity()) Fail(Step, Op, "CheckIntegrity() failed");
+
+	const size_t Cards = Game.GetPairs() * 2;
+	if (Game.GetPlayerPairs(StackMem::Players::Player1) != M.Pairs[0]) Fail(Step, Op, "Player 1 has the wrong amount of pairs");
+	if (Game.GetPlayerPairs(StackMem::Players::Player2) != M.Pairs[1]) Fail(Step, Op, "Player 2 has the wrong amount of pairs");
+
+	/* The card getters have to stay in range, also with 0 pairs. */
+	std::vector<uint8_t> TypeCount(Game.GetPairs(), 0);
+	size_t Shown = 0, Open = 0; // Open are the shown cards, which must be shown: Collected or turn cards.
+
+	for (size_t Idx = 0; Idx < Cards; Idx++) {
+		const int Type = Game.GetCardType(Idx);
+		if (Type < 0 || (size_t)Type >= Game.GetPairs() || ++TypeCount[Type] > 2) Fail(Step, Op, "GetCardType() is out of range");
+
+		if (Game.IsCardShown(Idx)) Shown++;
+		if (Game.IsCardCollected(Idx) || Game.GetTurnCard(0) == (int)Idx || Game.GetTurnCard(1) == (int)Idx) Open++;
+	}
+
+	if (Game.GetCardType(Cards) != -1 || Game.GetCardType(SIZE_MAX) != -1) Fail(Step, Op, "GetCardType() didn't refuse an index");
+	if (Game.IsCardShown(Cards) || !Game.IsCardCollected(Cards)) Fail(Step, Op, "An index past the cards is playable");
+
+	/* The shown cards against the turn state. */
+	if (Shown != M.Shown) Fail(Step, Op, "The amount of shown cards doesn't match the operations");
+	if (Shown < Open) Fail(Step, Op, "A collected or turn card is hidden");
+
+	const size_t TurnCards = (Game.GetTurnCard(0) != -1) + (Game.GetTurnCard(1) != -1);
+	if (TurnCards != (size_t)Game.GetState()) Fail(Step, Op, "The turn cards don't match the turn state");
+}
+
+
+/*
+	Checks, that a setter either did exactly the requested change or nothing at all.
+
+	const State &Before: The state before the setter.
+	const State &After: The state after the setter.
+	State Expected: The state with the requested change.
+	const size_t Step: The index of the operation.
+	const char *Op: The name of the operation.
+
+	Returns true, if the change got done.
+*/
+static bool Applied(const State &Before, const State &After, const State &Expected, const size_t Step, const char *Op) {
+	if (After == Expected) return true;
+	if (After == Before) return false;
+
+	Fail(Step, Op, "A refused change didn't leave the state unchanged");
+}
+
+
+/*
+	Runs the operations of an input on a new game.
+
+	const uint8_t *Data: The input.
+	const size_t Size: The size of the input.
+*/
+static void Run(const uint8_t *Data, const size_t Size) {
+	Reader In(Data, Size);
+
+	StackMem Game(In.Byte() % (MAX_PAIRS + 1), In.Bool(), (StackMem::AIMethod)(In.Byte() % 4));
+	Game.SetSeed(In.Byte()); // The constructor seeds with the time, so inputs need their own seed to be repeatable.
+	Game.InitializeGame(Game.GetPairs(), Game.AIEnabled(), Game.GetMethod());
+
+	Model M;
+	Check(Game, M, 0, "InitializeGame");
+
+	for (size_t Step = 1; !In.Empty(); Step++) {
+		const char *Op = "";
+		const State Before = Read(Game);
+		State Expected = Before;
+
+		switch(In.Byte() % 11) {
+			case 0:
+				Op = "InitializeGame";
+				Game.InitializeGame(In.Byte() % (MAX_PAIRS + 1), In.Bool(), (StackMem::AIMethod)(In.Byte() % 4));
+				M = { };
+				break;
+
+			case 1: {
+				Op = "SetCardShown";
+				const size_t Idx = In.Byte(); // Indexes can be out of range on purpose.
+				const bool Shown = In.Bool();
+				Game.SetCardShown(Idx, Shown);
+
+				if (Idx < Before.Cards.size()) {
+					Expected.Cards[Idx].Shown = Shown;
+					if (Applied(Before, Read(Game), Expected, Step, Op) && Shown != Before.Cards[Idx].Shown) {
+						if (Shown) M.Shown++;
+						else M.Shown--;
+					}
+
+				} else if (!(Read(Game) == Before)) Fail(Step, Op, "An index past the cards changed the state");
+				break;
+			}
+
+			case 2: {
+				Op = "SetCardCollected";
+				const size_t Idx = In.Byte();
+				const bool Collected = In.Bool();
+				Game.SetCardCollected(Idx, Collected);
+
+				if (Idx < Before.Cards.size()) {
+					Expected.Cards[Idx].Collected = Collected;
+					Applied(Before, Read(Game), Expected, Step, Op);
+
+				} else if (!(Read(Game) == Before)) Fail(Step, Op, "An index past the cards changed the state");
+				break;
+			}
+
+			case 3:
+				Op = "SetState";
+				Expected.Turn = (StackMem::TurnState)(In.Byte() % 3);
+				Game.SetState(Expected.Turn);
+				Applied(Before, Read(Game), Expected, Step, Op);
+				break;
+
+			case 4:
+				Op = "SetCurrentPlayer";
+				Expected.Player = (StackMem::Players)In.Bool();
+				Game.SetCurrentPlayer(Expected.Player);
+				if (!Applied(Before, Read(Game), Expected, Step, Op)) Fail(Step, Op, "The player didn't change");
+				break;
+
+			case 5:
+				Op = "DoPlay";
+				if (Game.DoPlay(In.Byte())) M.Shown++;
+				else if (!(Read(Game) == Before)) Fail(Step, Op, "A refused play changed the state");
+				break;
+
+			case 6: {
+				Op = "AIPlay";
+				const int Card = Game.AIPlay();
+				if (!(Read(Game) == Before)) Fail(Step, Op, "The AI changed the state without playing");
+
+				if (Card != -1 && (size_t)Card >= Game.GetPairs() * 2) {
+					fprintf(stderr, "StackMem::AIPlay returned %d with %zu cards at step %zu.\n", Card, Game.GetPairs() * 2, Step);
+					abort();
+				}
+
+				Op = "DoPlay (AI)";
+				if (Game.DoPlay(Card)) M.Shown++;
+				break;
+			}
+
+			case 7: {
+				Op = "DoCheck";
+				const bool Hide = In.Bool();
+				const bool Turn = (Before.Turn == StackMem::TurnState::DoCheck && Before.TurnCards[0] != -1 && Before.TurnCards[1] != -1);
+				const bool Match = (Turn && Before.Cards[Before.TurnCards[0]].Type == Before.Cards[Before.TurnCards[1]].Type);
+
+				if (Game.DoCheck(Hide) != Match) Fail(Step, Op, "DoCheck() returned the wrong result");
+				if (!Turn || M.Checked) break; // Nothing new to handle.
+
+				M.Checked = true;
+				if (Match) M.Pairs[(uint8_t)Before.Player]++;
+				else if (Hide) { // The turn ends and the cards get hidden again.
+					for (const int Idx : Before.TurnCards) M.Shown -= !Before.Cards[Idx].Collected;
+				}
+				break;
+			}
+
+			case 8: {
+				Op = "Collect";
+				const int Cards[2] = { Game.GetTurnCard(0), Game.GetTurnCard(1) }; // Like the Gamefield after DoCheck(false).
+				Game.SetCardCollected(Cards[0], true);
+				Check(Game, M, Step, Op);
+				Game.SetCardCollected(Cards[1], true);
+				break;
+			}
+
+			case 9: {
+				Op = "ResetTurn";
+				const bool Correct = In.Bool();
+				const bool Match = (M.Checked && Before.TurnCards[1] != -1 && Before.Cards[Before.TurnCards[0]].Type == Before.Cards[Before.TurnCards[1]].Type);
+				Game.ResetTurn(Correct);
+
+				if (!Match && !Correct) { // The cards of a turn without a pair get hidden.
+					for (const int Idx : Before.TurnCards) {
+						if (Idx != -1) M.Shown -= !Before.Cards[Idx].Collected;
+					}
+				}
+				break;
+			}
+
+			case 10:
+				Op = "NextPlayer";
+				Game.NextPlayer();
+				break;
+		}
+
+		if (Game.GetTurnCard(0) == -1) M.Checked = false; // A new turn.
+		Check(Game, M, Step, Op);
+	}
+}
+
+
+#ifdef LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *Data, size_t Size) {
+	Run(Data, Size);
+	return 0;
+}
+
+#else
+
+int main(int Argc, char *Argv[]) {
+	const unsigned long Runs = (Argc > 1 ? std::stoul(Argv[1]) : 20000);
+	const uint32_t Seed = (Argc > 2 ? std::stoul(Argv[2]) : std::random_device()());
+	printf("Running %lu inputs with seed %u.\n", Runs, Seed);
+
+	std::mt19937 Random(Seed);
+	std::vector<uint8_t> Input;
+
+	for (unsigned long Idx = 0; Idx < Runs; Idx++) {
+		Input.resize(1 + Random() % 1024);
+		for (uint8_t &Byte : Input) Byte = Random();
+
+		Run(Input.data(), Input.size());
+	}
+
+	printf("All inputs kept StackMem consistent.\n");
+	return 0;
+}
+
+#endif